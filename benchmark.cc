@@ -0,0 +1,1630 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "map_avl.h"
+#include "map_range_sum_avl.h"
+#include "perf_counter.h"
+#include "set_avl.h"
+#include "set_avl_wal.h"
+#include "set_btree.h"
+#include "set_hybrid_avl.h"
+#include "set_roaring.h"
+#include "set_skip_list.h"
+#include "set_y_fast_trie.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <set>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+
+// 사용법: ./benchmark [원소의 개수] [benchmark 이름 ...]
+// benchmark 이름을 생략하면 모든 benchmark를 실행함
+
+namespace
+{
+// Rank, Minimum, Maximum처럼 결과를 출력하는 연산을 측정할 때 출력을 버리기 위한 buffer
+class NullBuffer : public std::streambuf
+{
+protected:
+    int overflow(int c) override { return c; }
+};
+
+// 최적화로 인해 측정 대상 연산이 제거되지 않도록 결과를 누적
+long long sink = 0;
+
+// 측정 구간의 시간과 하드웨어 카운터 값을 연산 1회당 값으로 출력
+template <typename Function>
+void MeasureRegion(const std::string& name, long long operations, Function function)
+{
+    static PerfCounter perf_counter;
+
+    auto start_time = std::chrono::steady_clock::now();
+    perf_counter.Start();
+
+    function();
+
+    perf_counter.Stop();
+    auto end_time = std::chrono::steady_clock::now();
+
+    double elapsed_ns = std::chrono::duration<double, std::nano>(end_time - start_time).count();
+
+    std::cout << std::left << std::setw(28) << name << std::right
+        << " ops=" << std::setw(10) << operations
+        << " ns/op=" << std::fixed << std::setprecision(1) << std::setw(9)
+        << elapsed_ns / std::max(operations, 1LL);
+    perf_counter.PrintPerOperation(std::cout, operations);
+    std::cout << "\n";
+}
+
+// 0부터 n - 1까지의 key를 무작위 순서로 return
+std::vector<int> MakeShuffledKeys(int n)
+{
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(20231215));
+    return keys;
+}
+
+// Insert, Find, Rank, Erase 기본 연산 측정
+void BenchmarkBasicOperations(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+    SetAVL<int> set;
+
+    MeasureRegion("insert/random", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Insert(key);
+    });
+
+    MeasureRegion("find/hit", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Find(key);
+    });
+
+    MeasureRegion("find/miss", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Find(key + n);
+    });
+
+    // Rank는 결과를 출력하므로 측정하는 동안 출력을 버림
+    int rank_operations = std::min(n, 1000);
+
+    MeasureRegion("rank", rank_operations, [&]()
+    {
+        NullBuffer null_buffer;
+        std::streambuf* original_buffer = std::cout.rdbuf(&null_buffer);
+
+        for (int i = 0; i < rank_operations; i++)
+            set.Rank(keys[i]);
+
+        std::cout.rdbuf(original_buffer);
+    });
+
+    MeasureRegion("erase/random", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Erase(key);
+    });
+
+    SetAVL<int> sorted_set;
+
+    MeasureRegion("insert/sorted", n, [&]()
+    {
+        for (int key = 0; key < n; key++)
+            sink += sorted_set.Insert(key);
+    });
+}
+
+// FindBatch와 Find를 반복 호출하는 경우를 비교
+void BenchmarkFindBatch(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+    SetAVL<int> set;
+
+    // 무작위 순서로 삽입하여 node가 heap에 흩어지도록 함
+    for (int key : keys)
+        set.Insert(key * 2);
+
+    // 절반은 있는 key, 절반은 없는 key
+    std::vector<int> queries(keys.size());
+
+    for (std::size_t i = 0; i < keys.size(); i++)
+        queries[i] = keys[i] * 2 + static_cast<int>(i % 2);
+
+    const int batch_size = 256;
+    std::vector<int> batch;
+    std::vector<int> depths;
+
+    MeasureRegion("find/loop", n, [&]()
+    {
+        for (int query : queries)
+            sink += set.Find(query);
+    });
+
+    MeasureRegion("find/batch256", n, [&]()
+    {
+        for (int begin = 0; begin < n; begin += batch_size)
+        {
+            int end = std::min(n, begin + batch_size);
+            batch.assign(queries.begin() + begin, queries.begin() + end);
+            set.FindBatch(batch, depths);
+
+            for (int depth : depths)
+                sink += depth;
+        }
+    });
+}
+
+// 정렬된 key, 거의 정렬된 key, 무작위 key를 Insert와 InsertNearFinger로 삽입하는 경우를 비교
+void BenchmarkFingerInsert(int n)
+{
+    std::vector<int> sorted_keys(n);
+    std::iota(sorted_keys.begin(), sorted_keys.end(), 0);
+
+    // 거의 정렬된 key: 정렬된 key에서 1%의 위치를 근처(최대 16칸)의 key와 교환
+    std::vector<int> nearly_sorted_keys = sorted_keys;
+    std::mt19937 random(11);
+
+    for (int i = 0; i < n / 100; i++)
+    {
+        int position = static_cast<int>(random() % n);
+        int other = std::min(n - 1, position + static_cast<int>(random() % 16));
+        std::swap(nearly_sorted_keys[position], nearly_sorted_keys[other]);
+    }
+
+    const std::pair<const char*, std::vector<int>> streams[] = {
+        { "sorted", sorted_keys },
+        { "nearly_sorted", nearly_sorted_keys },
+        { "random", MakeShuffledKeys(n) },
+    };
+
+    for (const auto& stream : streams)
+    {
+        const std::vector<int>& keys = stream.second;
+
+        {
+            SetAVL<int> set;
+            MeasureRegion(std::string("finger_insert/") + stream.first + "/root", n, [&]()
+            {
+                for (int key : keys)
+                    sink += set.Insert(key);
+            });
+        }
+
+        {
+            SetAVL<int> set;
+            MeasureRegion(std::string("finger_insert/") + stream.first + "/finger", n, [&]()
+            {
+                for (int key : keys)
+                    sink += set.InsertNearFinger(key);
+            });
+        }
+    }
+}
+
+// SetAVL을 priority queue로 사용하는 경우를 std::priority_queue, std::set과 비교
+// 원소 n개를 채운 뒤 최솟값을 꺼내고 더 큰 key를 넣는 연산을 반복
+void BenchmarkPriorityQueue(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+    const long long operations = n;
+
+    {
+        SetAVL<int> set;
+        for (int key : keys)
+            set.Insert(key);
+
+        MeasureRegion("priority_queue/set_avl", operations, [&]()
+        {
+            int key = 0;
+            for (long long i = 0; i < operations; i++)
+            {
+                set.PopMin(key);
+                set.Insert(key + n);
+                sink += key;
+            }
+        });
+    }
+
+    {
+        std::set<int> set(keys.begin(), keys.end());
+
+        MeasureRegion("priority_queue/std_set", operations, [&]()
+        {
+            for (long long i = 0; i < operations; i++)
+            {
+                int key = *set.begin();
+                set.erase(set.begin());
+                set.insert(key + n);
+                sink += key;
+            }
+        });
+    }
+
+    {
+        std::priority_queue<int, std::vector<int>, std::greater<int>> queue(
+            keys.begin(), keys.end());
+
+        MeasureRegion("priority_queue/binary_heap", operations, [&]()
+        {
+            for (long long i = 0; i < operations; i++)
+            {
+                int key = queue.top();
+                queue.pop();
+                queue.push(key + n);
+                sink += key;
+            }
+        });
+    }
+
+    // 최솟값을 조회만 하는 경우
+    SetAVL<int> set;
+    for (int key : keys)
+        set.Insert(key);
+
+    MeasureRegion("priority_queue/get_min", operations, [&]()
+    {
+        int key = 0;
+        for (long long i = 0; i < operations; i++)
+        {
+            set.GetMin(key);
+            sink += key;
+        }
+    });
+}
+
+// 두 Set 사이에서 원소를 옮기는 경우 Extract + Insert(handle)과 Erase + Insert를 비교
+void BenchmarkNodeHandle(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+    SetAVL<int> source;
+    SetAVL<int> destination;
+
+    for (int key : keys)
+        source.Insert(key);
+
+    MeasureRegion("node_handle/erase_insert", n, [&]()
+    {
+        for (int key : keys)
+        {
+            source.Erase(key);
+            sink += destination.Insert(key);
+        }
+    });
+
+    MeasureRegion("node_handle/extract_insert", n, [&]()
+    {
+        for (int key : keys)
+        {
+            NodeHandleAVL<int> handle = destination.Extract(key);
+            sink += source.Insert(handle);
+        }
+    });
+
+    // 짝수 key와 홀수 key로 나뉜 두 Set을 합치는 경우
+    SetAVL<int> even_set;
+    SetAVL<int> odd_set;
+
+    for (int key : keys)
+        (key % 2 == 0 ? even_set : odd_set).Insert(key);
+
+    // 두 경우 모두 복사한 Set을 사용하여 node의 메모리 배치를 같게 함
+    SetAVL<int> even_copy(even_set);
+    SetAVL<int> odd_copy(odd_set);
+
+    MeasureRegion("node_handle/pop_insert_loop", n / 2, [&]()
+    {
+        int key = 0;
+        while (odd_copy.PopMin(key))
+            sink += even_copy.Insert(key);
+    });
+
+    even_copy = even_set;
+    odd_copy = odd_set;
+
+    MeasureRegion("node_handle/merge", n / 2, [&]()
+    {
+        even_copy.Merge(odd_copy);
+        sink += even_copy.GetSize();
+    });
+}
+
+// 원소가 적은 Set 여러 개를 만들고 탐색하는 경우 SetAVL과 SetHybridAVL을 비교
+template <typename SetType>
+void MeasureSmallSets(const std::string& name, int set_count, int set_size)
+{
+    std::vector<SetType> sets(set_count);
+    std::mt19937 random(5);
+    std::vector<int> queries;
+
+    for (int i = 0; i < set_count * set_size; i++)
+        queries.push_back(static_cast<int>(random() % (2 * set_size)));
+
+    const long long operations = static_cast<long long>(set_count) * set_size;
+
+    MeasureRegion(name + "/insert", operations, [&]()
+    {
+        for (int i = 0; i < set_count; i++)
+            for (int j = 0; j < set_size; j++)
+                sink += sets[i].Insert(queries[i * set_size + j] ^ j);
+    });
+
+    MeasureRegion(name + "/find", operations, [&]()
+    {
+        for (int i = 0; i < set_count; i++)
+            for (int j = 0; j < set_size; j++)
+                sink += sets[i].Find(queries[i * set_size + j]);
+    });
+}
+
+void BenchmarkSmallSet(int n)
+{
+    const int set_sizes[] = { 4, 12, 32 };
+
+    for (int set_size : set_sizes)
+    {
+        int set_count = std::max(1, n / set_size);
+        std::string suffix = "/size=" + std::to_string(set_size);
+
+        MeasureSmallSets<SetAVL<int>>("small_set/avl" + suffix, set_count, set_size);
+        MeasureSmallSets<SetHybridAVL<int>>("small_set/hybrid" + suffix, set_count, set_size);
+    }
+}
+
+// 한 가지 key 분포에 대해 SetAVL과 SetRoaring의 Insert, Find 시간과 메모리를 비교
+void MeasureRoaringDistribution(const std::string& name, const std::vector<int>& keys)
+{
+    const long long operations = static_cast<long long>(keys.size());
+    SetAVL<int> avl_set;
+    SetRoaring roaring_set;
+
+    MeasureRegion("roaring/" + name + "/avl_insert", operations, [&]()
+    {
+        for (int key : keys)
+            sink += avl_set.Insert(key);
+    });
+
+    MeasureRegion("roaring/" + name + "/roaring_insert", operations, [&]()
+    {
+        for (int key : keys)
+            sink += roaring_set.Insert(key);
+        roaring_set.Optimize();
+    });
+
+    MeasureRegion("roaring/" + name + "/avl_find", operations, [&]()
+    {
+        for (int key : keys)
+            sink += avl_set.Find(key);
+    });
+
+    MeasureRegion("roaring/" + name + "/roaring_find", operations, [&]()
+    {
+        for (int key : keys)
+            sink += roaring_set.Find(key);
+    });
+
+    // SetAVL은 malloc의 부가 비용을 제외한 node의 크기만 계산
+    int array_count = 0;
+    int bitmap_count = 0;
+    int run_count = 0;
+    roaring_set.CountContainers(array_count, bitmap_count, run_count);
+
+    const double avl_bytes = static_cast<double>(avl_set.GetSize()) * sizeof(NodeAVL<int>);
+    const double roaring_bytes = static_cast<double>(roaring_set.GetMemoryBytes());
+
+    std::cout << "roaring/" << name << "/memory"
+        << " avl_bytes/key=" << std::setprecision(2) << avl_bytes / avl_set.GetSize()
+        << " roaring_bytes/key=" << roaring_bytes / roaring_set.GetSize()
+        << " containers(array/bitmap/run)=" << array_count << "/" << bitmap_count
+        << "/" << run_count << "\n";
+}
+
+// 빽빽한 key, 흩어진 key, 구간에 몰려 있는 key에 대해 SetAVL과 SetRoaring을 비교
+void BenchmarkRoaring(int n)
+{
+    std::mt19937 random(37);
+
+    // 0부터 n - 1까지
+    std::vector<int> dense_keys = MakeShuffledKeys(n);
+
+    // 32bit 전체 범위에 흩어져 있음
+    std::vector<int> sparse_keys(n);
+    for (int& key : sparse_keys)
+        key = static_cast<int>(random());
+
+    // 길이 1000의 연속 구간이 전체 범위에 흩어져 있음
+    std::vector<int> clustered_keys;
+    while (static_cast<int>(clustered_keys.size()) < n)
+    {
+        int start = static_cast<int>(random() & 0x7fff0000u);
+        for (int i = 0; i < 1000 && static_cast<int>(clustered_keys.size()) < n; i++)
+            clustered_keys.push_back(start + i);
+    }
+    std::shuffle(clustered_keys.begin(), clustered_keys.end(), random);
+
+    MeasureRoaringDistribution("dense", dense_keys);
+    MeasureRoaringDistribution("sparse", sparse_keys);
+    MeasureRoaringDistribution("clustered", clustered_keys);
+}
+
+// 원소의 개수를 늘려가며 SetAVL과 SetYFastTrie의 Insert, Find, 이전 key 탐색을 비교
+void BenchmarkYFastTrie(int n)
+{
+    for (int size = std::max(1, n / 1000); size <= n; size *= 10)
+    {
+        std::mt19937 random(38);
+        std::vector<int> keys(size);
+        std::vector<int> queries(n);
+
+        for (int& key : keys)
+            key = static_cast<int>(random());
+        for (int& query : queries)
+            query = static_cast<int>(random());
+
+        const long long operations = static_cast<long long>(queries.size());
+        const std::string suffix = "/size=" + std::to_string(size);
+        SetAVL<int> avl_set;
+        SetYFastTrie<int> trie_set;
+
+        MeasureRegion("y_fast_trie/avl_insert" + suffix, size, [&]()
+        {
+            for (int key : keys)
+                sink += avl_set.Insert(key);
+        });
+
+        MeasureRegion("y_fast_trie/trie_insert" + suffix, size, [&]()
+        {
+            for (int key : keys)
+                sink += trie_set.Insert(key);
+        });
+
+        MeasureRegion("y_fast_trie/avl_find" + suffix, operations, [&]()
+        {
+            for (int query : queries)
+                sink += avl_set.Find(query);
+        });
+
+        MeasureRegion("y_fast_trie/trie_find" + suffix, operations, [&]()
+        {
+            for (int query : queries)
+                sink += trie_set.Find(query);
+        });
+
+        MeasureRegion("y_fast_trie/trie_predecessor" + suffix, operations, [&]()
+        {
+            int key = 0;
+            for (int query : queries)
+                sink += trie_set.Predecessor(query, key) ? key : 0;
+        });
+
+        // Rank는 결과를 출력하므로 측정하는 동안 출력을 버림
+        // SetAVL::Rank는 tree 전체를 순회하므로 적은 횟수만 측정
+        const int avl_rank_operations = std::min(size, 100);
+
+        MeasureRegion("y_fast_trie/avl_rank" + suffix, avl_rank_operations, [&]()
+        {
+            NullBuffer null_buffer;
+            std::streambuf* original_buffer = std::cout.rdbuf(&null_buffer);
+
+            for (int i = 0; i < avl_rank_operations; i++)
+                avl_set.Rank(keys[i]);
+
+            std::cout.rdbuf(original_buffer);
+        });
+
+        MeasureRegion("y_fast_trie/trie_rank" + suffix, size, [&]()
+        {
+            NullBuffer null_buffer;
+            std::streambuf* original_buffer = std::cout.rdbuf(&null_buffer);
+
+            for (int key : keys)
+                trie_set.Rank(key);
+
+            std::cout.rdbuf(original_buffer);
+        });
+    }
+}
+
+// 같은 key로 Insert, Find, Rank, Erase를 측정 (SetAVL과 SetBTree 비교용)
+template <typename SetType>
+void MeasureSetOperations(const std::string& name, const std::vector<int>& keys, SetType& set)
+{
+    const int n = static_cast<int>(keys.size());
+
+    MeasureRegion(name + "/insert", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Insert(key);
+    });
+
+    MeasureRegion(name + "/find_hit", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Find(key);
+    });
+
+    MeasureRegion(name + "/find_miss", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Find(key + n);
+    });
+
+    // Rank는 결과를 출력하므로 측정하는 동안 출력을 버림
+    // SetAVL::Rank는 tree 전체를 순회하므로 적은 횟수만 측정
+    int rank_operations = std::min(n, 100);
+
+    MeasureRegion(name + "/rank", rank_operations, [&]()
+    {
+        NullBuffer null_buffer;
+        std::streambuf* original_buffer = std::cout.rdbuf(&null_buffer);
+
+        for (int i = 0; i < rank_operations; i++)
+            set.Rank(keys[i]);
+
+        std::cout.rdbuf(original_buffer);
+    });
+}
+
+// SetAVL과 SetBTree를 같은 연산으로 비교하고, SetBTree의 범위 탐색을 측정
+void BenchmarkBTree(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+    SetAVL<int> avl_set;
+    SetBTree<int> btree_set;
+
+    MeasureSetOperations("btree/avl", keys, avl_set);
+    MeasureSetOperations("btree/btree", keys, btree_set);
+
+    // 길이 1000의 범위를 연결된 leaf를 따라가며 읽음
+    const int range_length = 1000;
+    const int range_count = std::max(1, n / range_length);
+
+    MeasureRegion("btree/btree/range_scan_per_key", static_cast<long long>(range_count) * range_length, [&]()
+    {
+        for (int i = 0; i < range_count; i++)
+        {
+            int first = keys[i] % std::max(1, n - range_length);
+            btree_set.ForEachInRange(first, first + range_length - 1, [](int key) { sink += key; });
+        }
+    });
+
+    MeasureRegion("btree/avl/erase", n, [&]()
+    {
+        for (int key : keys)
+            sink += avl_set.Erase(key);
+    });
+
+    MeasureRegion("btree/btree/erase", n, [&]()
+    {
+        for (int key : keys)
+            sink += btree_set.Erase(key);
+    });
+}
+
+// 하나의 mutex로 모든 연산을 보호한 SetAVL (SetSkipList와 비교용)
+class LockedSetAVL
+{
+public:
+    int Find(int key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return set_.Find(key);
+    }
+
+    int Insert(int key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return set_.Insert(key);
+    }
+
+    int Erase(int key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return set_.Erase(key);
+    }
+private:
+    std::mutex mutex_;
+    SetAVL<int> set_;
+};
+
+// 여러 thread가 Find와 Insert/Erase를 섞어 호출하는 경우를 측정
+// 쓰기 연산은 write_percent%의 확률로 Insert와 Erase를 반씩 호출함
+template <typename SetType>
+void MeasureConcurrentMix(const std::string& name, int key_range, int thread_count,
+    int write_percent, int total_operations)
+{
+    SetType set;
+
+    // 절반의 key를 미리 넣어둠
+    for (int key = 0; key < key_range; key += 2)
+        set.Insert(key);
+
+    const int operations_per_thread = std::max(1, total_operations / thread_count);
+    std::atomic<long long> thread_sink(0);
+
+    MeasureRegion(name, static_cast<long long>(operations_per_thread) * thread_count, [&]()
+    {
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back([&set, &thread_sink, t, key_range, write_percent, operations_per_thread]()
+            {
+                std::mt19937 random(20231215 + t);
+                long long local_sink = 0;
+
+                for (int i = 0; i < operations_per_thread; i++)
+                {
+                    int key = static_cast<int>(random() % key_range);
+                    int choice = static_cast<int>(random() % 200);
+
+                    if (choice < write_percent)
+                        local_sink += set.Insert(key);
+                    else if (choice < write_percent * 2)
+                        local_sink += set.Erase(key);
+                    else
+                        local_sink += set.Find(key);
+                }
+
+                thread_sink += local_sink;
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+    });
+
+    sink += thread_sink.load();
+}
+
+// mutex로 보호한 SetAVL과 SetSkipList를 thread 개수와 쓰기 비율별로 비교
+void BenchmarkSkipList(int n)
+{
+    const int key_range = std::max(2, n);
+    const int total_operations = std::max(1, std::min(n, 200000));
+
+    for (int write_percent : { 5, 50, 95 })
+    {
+        for (int thread_count = 1; thread_count <= 64; thread_count *= 2)
+        {
+            const std::string suffix = "/w" + std::to_string(write_percent) + "/t" + std::to_string(thread_count);
+
+            MeasureConcurrentMix<LockedSetAVL>("skip_list/locked_avl" + suffix, key_range, thread_count,
+                write_percent, total_operations);
+            MeasureConcurrentMix<SetSkipList<int>>("skip_list/skip_list" + suffix, key_range, thread_count,
+                write_percent, total_operations);
+        }
+    }
+}
+
+// BalancePolicy별로 삽입과 삭제의 rotation 횟수, 삭제 한 번의 latency 분포를 측정
+template <typename BalancePolicy>
+void MeasureBalancePolicy(const std::string& name, const std::vector<int>& keys,
+    const std::vector<int>& erase_keys)
+{
+    const int n = static_cast<int>(keys.size());
+    SetAVL<int, BalancePolicy> set;
+
+    MeasureRegion(name + "/insert", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Insert(key);
+    });
+
+    const long long insert_rotations = set.GetRotationCount();
+
+    // 삭제를 하나씩 시간을 재어 분포를 구함 (시간 측정 비용이 포함됨)
+    std::vector<double> latencies(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+        sink += set.Erase(erase_keys[i]);
+        auto end_time = std::chrono::steady_clock::now();
+
+        latencies[i] = std::chrono::duration<double, std::nano>(end_time - start_time).count();
+    }
+
+    const long long erase_rotations = set.GetRotationCount() - insert_rotations;
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << std::left << std::setw(28) << (name + "/erase") << std::right
+        << " ops=" << std::setw(10) << n
+        << std::fixed << std::setprecision(1)
+        << " p50_ns=" << std::setw(8) << latencies[n / 2]
+        << " p99_ns=" << std::setw(8) << latencies[std::min(n - 1, n * 99 / 100)]
+        << " max_ns=" << std::setw(10) << latencies[n - 1]
+        << std::setprecision(3)
+        << " rotations/insert=" << static_cast<double>(insert_rotations) / n
+        << " rotations/erase=" << static_cast<double>(erase_rotations) / n << "\n";
+}
+
+// AVLBalancePolicy와 WeakAVLBalancePolicy를 같은 key로 비교
+void BenchmarkWeakAVL(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+    std::vector<int> erase_keys = keys;
+    std::shuffle(erase_keys.begin(), erase_keys.end(), std::mt19937(19));
+
+    MeasureBalancePolicy<AVLBalancePolicy>("weak_avl/avl", keys, erase_keys);
+    MeasureBalancePolicy<WeakAVLBalancePolicy>("weak_avl/weak_avl", keys, erase_keys);
+}
+
+// relaxed balance에서 삽입 burst의 처리량과, 그 뒤 rebalancing 전후의 탐색 시간을 측정
+// budget이 -1이면 relaxed balance를 사용하지 않음
+void MeasureRelaxedBalance(const std::string& name, const std::vector<int>& keys, int budget)
+{
+    const int n = static_cast<int>(keys.size());
+    SetAVL<int> set;
+
+    if (budget >= 0)
+        set.SetRelaxedBalance(true, budget);
+
+    MeasureRegion(name + "/insert_burst", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Insert(key);
+    });
+
+    std::cout << name << "/height_after_burst " << set.ShapeReport().height
+        << " pending=" << set.GetPendingCount() << "\n";
+
+    MeasureRegion(name + "/find_before_drain", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Find(key);
+    });
+
+    MeasureRegion(name + "/drain", std::max(1, set.GetPendingCount()), [&]()
+    {
+        set.SetRelaxedBalance(false);
+    });
+
+    std::cout << name << "/height_after_drain " << set.ShapeReport().height << "\n";
+
+    MeasureRegion(name + "/find_after_drain", n, [&]()
+    {
+        for (int key : keys)
+            sink += set.Find(key);
+    });
+}
+
+// 즉시 rebalancing하는 경우와 relaxed balance의 budget별 비교
+void BenchmarkRelaxedBalance(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+
+    MeasureRelaxedBalance("relaxed/strict", keys, -1);
+
+    for (int budget : { 0, 1, 4 })
+        MeasureRelaxedBalance("relaxed/budget" + std::to_string(budget), keys, budget);
+}
+
+// SetAVL과 Freeze로 만든 FrozenSetAVL의 탐색을 원소의 개수별로 비교
+// 원소의 개수는 1024개(L1 cache)부터 16배씩 늘리고 마지막으로 n개에서 측정 (LLC보다 큰 경우 포함)
+void BenchmarkFreeze(int n)
+{
+    const int query_count = 1 << 20;
+    std::vector<int> set_sizes;
+
+    for (long long size = 1024; size < n; size *= 16)
+        set_sizes.push_back(static_cast<int>(size));
+    set_sizes.push_back(std::max(n, 1));
+
+    for (int set_size : set_sizes)
+    {
+        const long long size = set_size;
+        std::vector<int> keys = MakeShuffledKeys(set_size);
+        SetAVL<int> set;
+
+        for (int key : keys)
+            set.Insert(key * 2);
+
+        FrozenSetAVL<int> frozen_set = set.Freeze();
+
+        // 절반은 Set에 있는 key, 절반은 없는 key
+        std::vector<int> queries(query_count);
+        std::mt19937 random(20231215);
+
+        for (int& query : queries)
+            query = static_cast<int>(random() % (2 * size));
+
+        const std::string suffix = "/n" + std::to_string(set_size);
+
+        MeasureRegion("freeze/avl/find" + suffix, query_count, [&]()
+        {
+            for (int query : queries)
+                sink += set.Find(query);
+        });
+
+        MeasureRegion("freeze/frozen/find" + suffix, query_count, [&]()
+        {
+            for (int query : queries)
+                sink += frozen_set.Find(query);
+        });
+
+        MeasureRegion("freeze/frozen/rank" + suffix, query_count, [&]()
+        {
+            for (int query : queries)
+                sink += frozen_set.GetRank(query);
+        });
+
+        std::cout << "freeze/bytes_per_element" << suffix
+            << " avl=" << set.ShapeReport().bytes_per_element
+            << " frozen=" << static_cast<double>(frozen_set.GetMemoryBytes()) / set_size << "\n";
+    }
+}
+
+// 삽입과 삭제를 반복하여 node가 heap에 흩어진 SetAVL에서 Compact 전후의 탐색과 순회를 비교
+// 순회는 모든 key를 오름차순으로 ContainsSorted에 넘겨 tree 전체를 한 번 방문하는 것으로 측정
+void BenchmarkCompact(int n)
+{
+    const int query_count = 1 << 20;
+    std::vector<int> keys = MakeShuffledKeys(2 * n);
+    std::mt19937 random(20231215);
+    SetAVL<int> set;
+
+    // 절반을 삽입한 뒤 나머지 key의 삽입과 기존 key의 삭제를 번갈아 하여 node의 위치를 섞음
+    for (int i = 0; i < n; i++)
+        set.Insert(keys[i]);
+
+    for (int i = n; i < 2 * n; i++)
+    {
+        std::swap(keys[i], keys[random() % i]);
+        set.Erase(keys[i]);
+        set.Insert(keys[random() % i]);
+        set.Insert(keys[i]);
+    }
+
+    std::vector<int> queries(query_count);
+
+    for (int& query : queries)
+        query = static_cast<int>(random() % (2 * n));
+
+    std::vector<int> sorted_keys;
+
+    for (int key = 0; key < 2 * n; key++)
+        if (set.Contains(key))
+            sorted_keys.push_back(key);
+
+    std::vector<bool> found;
+
+    auto measure = [&](const std::string& name)
+    {
+        MeasureRegion("compact/" + name + "/find", query_count, [&]()
+        {
+            for (int query : queries)
+                sink += set.Find(query);
+        });
+
+        MeasureRegion("compact/" + name + "/scan", static_cast<long long>(sorted_keys.size()), [&]()
+        {
+            set.ContainsSorted(sorted_keys, found);
+            sink += found.size();
+        });
+    };
+
+    measure("fragmented");
+
+    MeasureRegion("compact/compact_inorder", set.GetSize(), [&]()
+    {
+        set.Compact(kSetAVLCompactInOrder);
+    });
+
+    measure("inorder");
+
+    MeasureRegion("compact/compact_veb", set.GetSize(), [&]()
+    {
+        set.Compact(kSetAVLCompactVanEmdeBoas);
+    });
+
+    measure("veb");
+
+    // 1ms씩 나누어 진행하는 경우 (이전 Compact의 영역에서 새 영역으로 옮김)
+    int call_count = 0;
+
+    MeasureRegion("compact/incremental_1ms", set.GetSize(), [&]()
+    {
+        while (!set.CompactIncrementally(std::chrono::milliseconds(1)))
+            call_count++;
+        call_count++;
+    });
+
+    std::cout << "compact/incremental_1ms calls=" << call_count << "\n";
+    measure("incremental");
+}
+
+// membership filter를 사용하는 경우와 사용하지 않는 경우의 Find를 비교
+// query의 80%는 Set에 없는 key이며, 없는 key만 찾는 경우와 있는 key만 찾는 경우도 따로 측정
+void BenchmarkMembershipFilter(int n)
+{
+    const int query_count = 1 << 20;
+    std::vector<int> keys = MakeShuffledKeys(n);
+    std::mt19937 random(20231215);
+
+    // 짝수만 Set에 넣고 홀수를 없는 key로 사용
+    std::vector<int> mixed_queries(query_count);
+    std::vector<int> miss_queries(query_count);
+    std::vector<int> hit_queries(query_count);
+
+    for (int i = 0; i < query_count; i++)
+    {
+        const int key = static_cast<int>(random() % n);
+        mixed_queries[i] = (random() % 5 == 0) ? 2 * key : 2 * key + 1;
+        miss_queries[i] = 2 * key + 1;
+        hit_queries[i] = 2 * key;
+    }
+
+    for (bool enabled : { false, true })
+    {
+        SetAVL<int> set;
+        set.SetMembershipFilter(enabled);
+
+        for (int key : keys)
+            set.Insert(2 * key);
+
+        const std::string prefix = enabled ? "filter/on" : "filter/off";
+
+        MeasureRegion(prefix + "/find_80%_miss", query_count, [&]()
+        {
+            for (int query : mixed_queries)
+                sink += set.Find(query);
+        });
+
+        MeasureRegion(prefix + "/find_miss", query_count, [&]()
+        {
+            for (int query : miss_queries)
+                sink += set.Find(query);
+        });
+
+        MeasureRegion(prefix + "/find_hit", query_count, [&]()
+        {
+            for (int query : hit_queries)
+                sink += set.Find(query);
+        });
+
+        if (!enabled)
+            continue;
+
+        // 절반을 삭제하고 다른 key를 다시 삽입하는 동안 filter를 다시 만든 뒤의 상태
+        MeasureRegion("filter/on/erase_insert", n, [&]()
+        {
+            for (int i = 0; i < n; i += 2)
+            {
+                set.Erase(2 * keys[i]);
+                set.Insert(2 * keys[i] + 2 * n);
+            }
+        });
+
+        const BlockedBloomFilter<int>* filter = set.GetMembershipFilter();
+        long long false_positive_count = 0;
+
+        for (int query : miss_queries)
+            false_positive_count += filter->MayContain(query);
+
+        std::cout << "filter/false_positive_percent=" << std::setprecision(3)
+            << 100.0 * false_positive_count / query_count
+            << " filter_bytes_per_element="
+            << static_cast<double>(filter->GetMemoryBytes()) / set.GetSize()
+            << " node_bytes_per_element=" << set.ShapeReport().bytes_per_element
+            << std::setprecision(1) << "\n";
+    }
+}
+
+// hash index를 사용하는 경우와 사용하지 않는 경우의 Contains, Find를 원소의 개수별로 비교
+// 원소의 개수는 10^4개부터 10배씩 늘리고 마지막으로 n개에서 측정
+void BenchmarkHashIndex(int n)
+{
+    const int query_count = 1 << 20;
+    std::vector<int> set_sizes;
+
+    for (long long size = 10000; size < n; size *= 10)
+        set_sizes.push_back(static_cast<int>(size));
+    set_sizes.push_back(std::max(n, 1));
+
+    for (int set_size : set_sizes)
+    {
+        std::vector<int> keys = MakeShuffledKeys(set_size);
+        SetAVL<int> set;
+
+        for (int key : keys)
+            set.Insert(2 * key);
+
+        // 짝수는 Set에 있는 key, 홀수는 없는 key
+        std::vector<int> hit_queries(query_count);
+        std::vector<int> miss_queries(query_count);
+        std::mt19937 random(20231215);
+
+        for (int i = 0; i < query_count; i++)
+        {
+            hit_queries[i] = 2 * static_cast<int>(random() % set_size);
+            miss_queries[i] = hit_queries[i] + 1;
+        }
+
+        const std::string suffix = "/n" + std::to_string(set_size);
+
+        for (bool enabled : { false, true })
+        {
+            set.SetHashIndex(enabled);
+            const std::string prefix = enabled ? "hash_index/on" : "hash_index/off";
+
+            MeasureRegion(prefix + "/contains_hit" + suffix, query_count, [&]()
+            {
+                for (int query : hit_queries)
+                    sink += set.Contains(query);
+            });
+
+            MeasureRegion(prefix + "/contains_miss" + suffix, query_count, [&]()
+            {
+                for (int query : miss_queries)
+                    sink += set.Contains(query);
+            });
+
+            MeasureRegion(prefix + "/find_hit" + suffix, query_count, [&]()
+            {
+                for (int query : hit_queries)
+                    sink += set.Find(query);
+            });
+        }
+
+        std::cout << "hash_index/bytes_per_element" << suffix << std::setprecision(2)
+            << " index=" << static_cast<double>(set.GetHashIndex()->GetMemoryBytes()) / set_size
+            << " nodes=" << set.ShapeReport().bytes_per_element << std::setprecision(1) << "\n";
+    }
+}
+
+// keys에서 Zipf 분포(i번째 key가 선택될 확률이 1 / (i + 1)^exponent에 비례)로 count개의 key를 뽑음
+// keys가 무작위 순서이므로 자주 뽑히는 key는 tree 곳곳에 흩어져 있음
+std::vector<int> MakeZipfQueries(const std::vector<int>& keys, double exponent, int count)
+{
+    std::vector<double> cumulative(keys.size());
+    double sum = 0.0;
+
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(i + 1), exponent);
+        cumulative[i] = sum;
+    }
+
+    std::mt19937 random(20231215);
+    std::uniform_real_distribution<double> distribution(0.0, sum);
+    std::vector<int> queries(count);
+
+    for (int& query : queries)
+    {
+        const auto it = std::lower_bound(cumulative.begin(), cumulative.end(), distribution(random));
+        query = keys[std::min<std::size_t>(it - cumulative.begin(), keys.size() - 1)];
+    }
+
+    return queries;
+}
+
+// hot key cache를 사용하는 경우와 사용하지 않는 경우를 Zipf 분포의 Find와 쓰기를 섞어서 비교
+// 쓰기는 Set에 없던 key를 Insert한 뒤 다음 쓰기에서 Erase하므로 매번 tree 모양이 바뀜
+void BenchmarkHotKeyCache(int n)
+{
+    const int operation_count = 1 << 20;
+    std::vector<int> keys = MakeShuffledKeys(n);
+    SetAVL<int> set;
+
+    for (int key : keys)
+        set.Insert(key);
+
+    for (double exponent : { 0.8, 1.0, 1.2 })
+    {
+        std::vector<int> queries = MakeZipfQueries(keys, exponent, operation_count);
+
+        for (int write_percent : { 1, 10 })
+        {
+            // 각 연산이 쓰기인지 미리 정해둠
+            std::vector<bool> is_write(operation_count);
+            std::mt19937 random(20231215);
+
+            for (int i = 0; i < operation_count; i++)
+                is_write[i] = static_cast<int>(random() % 100) < write_percent;
+
+            std::ostringstream name;
+            name << "hot_key/zipf" << exponent << "/write" << write_percent;
+
+            for (bool enabled : { false, true })
+            {
+                set.SetHotKeyCache(enabled);
+                int write_count = 0;
+
+                MeasureRegion(name.str() + (enabled ? "/on" : "/off"), operation_count, [&]()
+                {
+                    for (int i = 0; i < operation_count; i++)
+                    {
+                        if (!is_write[i])
+                            sink += set.Find(queries[i]);
+                        else if (write_count++ % 2 == 0)
+                            sink += set.Insert(n + write_count);
+                        else
+                            sink += set.Erase(n + write_count - 1);
+                    }
+                });
+
+                if (enabled)
+                {
+                    const HotKeyCacheStats stats = set.GetHotKeyCacheStats();
+                    const double lookup_count = static_cast<double>(
+                        stats.hit_count + stats.stale_hit_count + stats.miss_count);
+
+                    std::cout << name.str() << std::setprecision(3)
+                        << " hit=" << stats.hit_count / lookup_count
+                        << " stale_hit=" << stats.stale_hit_count / lookup_count
+                        << " miss=" << stats.miss_count / lookup_count
+                        << std::setprecision(1) << "\n";
+                }
+
+                // 쓰기로 남은 key를 지워서 다음 측정의 Set을 같게 맞춤
+                if (write_count % 2 == 1)
+                    set.Erase(n + write_count);
+            }
+        }
+    }
+
+    // SetAVL::Rank는 tree를 순회하지만 cache를 사용하면 size로 계산하므로 적은 횟수만 비교
+    std::vector<int> rank_queries = MakeZipfQueries(keys, 1.0, 100);
+
+    for (bool enabled : { false, true })
+    {
+        set.SetHotKeyCache(enabled);
+
+        MeasureRegion(std::string("hot_key/zipf1/rank") + (enabled ? "/on" : "/off"),
+            static_cast<long long>(rank_queries.size()), [&]()
+        {
+            NullBuffer null_buffer;
+            std::streambuf* original_buffer = std::cout.rdbuf(&null_buffer);
+
+            for (int query : rank_queries)
+                set.Rank(query);
+
+            std::cout.rdbuf(original_buffer);
+        });
+    }
+}
+
+// Augmentation이 없는 SetAVL과 key의 합을 저장하는 SetAVL의 삽입, 삭제 비용을 비교하고,
+// Aggregate로 구한 범위의 합과 정렬된 배열에서 범위를 차례로 더한 합을 범위의 크기별로 비교
+void BenchmarkAugmentation(int n)
+{
+    const int query_count = 1 << 16;
+    std::vector<int> keys = MakeShuffledKeys(n);
+    SetAVL<int> plain_set;
+    SetAVL<int, AVLBalancePolicy, SetAVLSumAugmentation<int>> sum_set;
+
+    MeasureRegion("augment/none/insert", n, [&]()
+    {
+        for (int key : keys)
+            sink += plain_set.Insert(key);
+    });
+
+    MeasureRegion("augment/sum/insert", n, [&]()
+    {
+        for (int key : keys)
+            sink += sum_set.Insert(key);
+    });
+
+    std::vector<int> sorted_keys(keys);
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+
+    for (int width : { 100, 10000, 1000000 })
+    {
+        if (width > n)
+            break;
+
+        std::vector<int> lows(query_count);
+        std::mt19937 random(20231215);
+
+        for (int i = 0; i < query_count; i++)
+            lows[i] = static_cast<int>(random() % (n - width + 1));
+
+        const std::string suffix = "/width" + std::to_string(width);
+        const int count = (width >= 1000000) ? query_count / 256 : query_count;
+
+        MeasureRegion("augment/sum/aggregate" + suffix, count, [&]()
+        {
+            for (int i = 0; i < count; i++)
+                sink += sum_set.Aggregate(lows[i], lows[i] + width - 1);
+        });
+
+        MeasureRegion("augment/sorted_scan" + suffix, count, [&]()
+        {
+            for (int i = 0; i < count; i++)
+            {
+                auto first = std::lower_bound(sorted_keys.begin(), sorted_keys.end(), lows[i]);
+                auto last = std::upper_bound(first, sorted_keys.end(), lows[i] + width - 1);
+                sink += std::accumulate(first, last, 0LL);
+            }
+        });
+    }
+
+    MeasureRegion("augment/none/erase", n, [&]()
+    {
+        for (int key : keys)
+            sink += plain_set.Erase(key);
+    });
+
+    MeasureRegion("augment/sum/erase", n, [&]()
+    {
+        for (int key : keys)
+            sink += sum_set.Erase(key);
+    });
+}
+
+// SetAVL과 std::unordered_map에 key와 value를 따로 저장하는 경우와 MapAVL을 비교
+// (따로 저장하면 삽입과 탐색마다 tree와 hash table을 한 번씩 찾음)
+void BenchmarkMap(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+    std::vector<int> queries(keys);
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(20231215));
+
+    SetAVL<int> key_set;
+    std::unordered_map<int, long long> values;
+    MapAVL<int, long long> map;
+
+    MeasureRegion("map/set_and_hash/insert", n, [&]()
+    {
+        for (int key : keys)
+        {
+            sink += key_set.Insert(key);
+            values.emplace(key, key);
+        }
+    });
+
+    MeasureRegion("map/map_avl/insert", n, [&]()
+    {
+        for (int key : keys)
+            map.TryEmplace(key, key);
+    });
+
+    MeasureRegion("map/set_and_hash/find", n, [&]()
+    {
+        for (int query : queries)
+        {
+            if (key_set.Contains(query))
+                sink += values.find(query)->second;
+        }
+    });
+
+    MeasureRegion("map/map_avl/find", n, [&]()
+    {
+        for (int query : queries)
+        {
+            const long long* value = map.Find(query);
+
+            if (value != nullptr)
+                sink += *value;
+        }
+    });
+
+    MeasureRegion("map/set_and_hash/assign", n, [&]()
+    {
+        for (int query : queries)
+        {
+            sink += key_set.Insert(query);
+            values[query] = query + 1;
+        }
+    });
+
+    MeasureRegion("map/map_avl/assign", n, [&]()
+    {
+        for (int query : queries)
+            sink += map.InsertOrAssign(query, query + 1);
+    });
+
+    std::cout << "map/bytes_per_element set_and_hash=" << std::setprecision(2)
+        << key_set.ShapeReport().bytes_per_element
+            + static_cast<double>(values.bucket_count() * sizeof(void*)
+                + values.size() * (sizeof(std::pair<const int, long long>) + 2 * sizeof(void*))) / n
+        << " map_avl=" << map.GetKeys().ShapeReport().bytes_per_element << std::setprecision(1) << "\n";
+}
+
+// 범위의 모든 value에 더하고 범위의 합을 구하는 연산을 MapRangeSumAVL의 tag로 처리하는 경우와
+// MapAVL에서 범위의 key를 하나씩 찾아 처리하는 경우(eager)를 범위의 크기별로 비교
+void BenchmarkRangeAdd(int n)
+{
+    const int operation_count = 1 << 14;
+    std::vector<int> keys = MakeShuffledKeys(n);
+    MapAVL<int, long long> eager_map;
+    MapRangeSumAVL<int, long long> lazy_map;
+
+    for (int key : keys)
+    {
+        eager_map.TryEmplace(key, key);
+        lazy_map.InsertOrAssign(key, key);
+    }
+
+    for (int width : { 16, 1024, 65536 })
+    {
+        if (width > n)
+            break;
+
+        std::vector<int> lows(operation_count);
+        std::mt19937 random(20231215);
+
+        for (int i = 0; i < operation_count; i++)
+            lows[i] = static_cast<int>(random() % (n - width + 1));
+
+        const std::string suffix = "/width" + std::to_string(width);
+
+        // 범위가 넓으면 eager는 느리므로 횟수를 줄임
+        const int count = std::max(16, operation_count / std::max(1, width / 64));
+
+        // 짝수 번째는 범위에 1을 더하고 홀수 번째는 범위의 합을 구함
+        MeasureRegion("range_add/eager" + suffix, count, [&]()
+        {
+            for (int i = 0; i < count; i++)
+            {
+                const int hi = lows[i] + width - 1;
+
+                for (int key = lows[i]; key <= hi; key++)
+                {
+                    long long* value = eager_map.Find(key);
+
+                    if (i % 2 == 0)
+                        *value += 1;
+                    else
+                        sink += *value;
+                }
+            }
+        });
+
+        MeasureRegion("range_add/lazy" + suffix, count, [&]()
+        {
+            for (int i = 0; i < count; i++)
+            {
+                if (i % 2 == 0)
+                    lazy_map.AddRange(lows[i], lows[i] + width - 1, 1);
+                else
+                    sink += lazy_map.SumRange(lows[i], lows[i] + width - 1);
+            }
+        });
+    }
+
+    // 두 Map에 같은 연산을 했으므로 전체 합이 같아야 함
+    long long eager_sum = 0;
+
+    for (int key = 0; key < n; key++)
+        eager_sum += *eager_map.Find(key);
+
+    std::cout << "range_add/total_sum eager=" << eager_sum << " lazy=" << lazy_map.SumRange(0, n - 1) << "\n";
+}
+
+// 정렬된 query를 QuerySorted로 한 번에 처리하는 경우와 Find를 반복 호출하는 경우를 비교
+void BenchmarkQuerySorted(int n)
+{
+    std::vector<int> keys = MakeShuffledKeys(n);
+    SetAVL<int> set;
+
+    for (int key : keys)
+        set.Insert(key * 2);
+
+    // 정렬된 query batch 여러 개 (batch마다 전체 key 범위에 흩어져 있음)
+    const int batch_size = 1024;
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> distribution(0, 2 * n);
+    std::vector<std::vector<int>> batches(std::max(1, n / batch_size));
+
+    for (std::vector<int>& batch : batches)
+    {
+        for (int i = 0; i < batch_size; i++)
+            batch.push_back(distribution(random));
+        std::sort(batch.begin(), batch.end());
+    }
+
+    long long operations = static_cast<long long>(batches.size()) * batch_size;
+    std::vector<SetAVLQueryResult> results;
+
+    MeasureRegion("query_sorted/find_loop", operations, [&]()
+    {
+        for (const std::vector<int>& batch : batches)
+            for (int query : batch)
+                sink += set.Find(query);
+    });
+
+    MeasureRegion("query_sorted/merged1024", operations, [&]()
+    {
+        for (const std::vector<int>& batch : batches)
+        {
+            set.QuerySorted(batch, results);
+            for (const SetAVLQueryResult& result : results)
+                sink += result.depth + result.rank;
+        }
+    });
+}
+
+// snapshot 저장과 O(n) 재구성을 key를 하나씩 다시 삽입하는 경우와 비교
+void BenchmarkSnapshot(int n)
+{
+    const std::string path = "set_avl_benchmark_snapshot.bin";
+    SetAVL<int> set;
+
+    for (int key = 0; key < n; key++)
+        set.Insert(key * 3);
+
+    MeasureRegion("snapshot/save", n, [&]()
+    {
+        sink += set.SaveSnapshot(path);
+    });
+
+    SetAVL<int> loaded_set;
+
+    MeasureRegion("snapshot/load", n, [&]()
+    {
+        sink += loaded_set.LoadSnapshot(path);
+    });
+
+    SetAVL<int> reinserted_set;
+
+    MeasureRegion("snapshot/reinsert", n, [&]()
+    {
+        for (int key = 0; key < n; key++)
+            sink += reinserted_set.Insert(key * 3);
+    });
+
+    std::remove(path.c_str());
+}
+
+// group commit window에 따른 durable Insert, Erase의 처리량 측정
+void BenchmarkWriteAheadLog(int n)
+{
+    const std::string directory = "set_avl_benchmark_wal";
+    const int thread_count = 8;
+    const int operations_per_thread = std::max(1, std::min(n / thread_count, 500));
+    const int windows_us[] = { 0, 100, 1000, 5000 };
+
+    for (int window_us : windows_us)
+    {
+        std::remove((directory + "/snapshot").c_str());
+        std::remove((directory + "/log").c_str());
+
+        SetAVL<int> set;
+        SetAVLWriteAheadLog<int> wal(
+            set, directory, std::chrono::microseconds(window_us), 1 << 20);
+
+        if (!wal.Open())
+        {
+            std::cout << "wal: cannot open " << directory << "\n";
+            return;
+        }
+
+        auto start_time = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back([&wal, t, operations_per_thread]()
+            {
+                for (int i = 0; i < operations_per_thread; i++)
+                {
+                    int key = t * operations_per_thread + i;
+                    wal.Insert(key);
+
+                    if (i % 4 == 3)
+                        wal.Erase(key - 1);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start_time).count();
+
+        std::cout << "wal/window=" << window_us << "us"
+            << " durable_records=" << wal.GetDurableRecordCount()
+            << " fdatasync=" << wal.GetSyncCount()
+            << " ops/s=" << std::fixed << std::setprecision(0)
+            << wal.GetDurableRecordCount() / seconds << "\n";
+    }
+
+    std::remove((directory + "/snapshot").c_str());
+    std::remove((directory + "/log").c_str());
+    rmdir(directory.c_str());
+}
+
+struct Benchmark
+{
+    const char* name;
+    std::function<void(int)> function;
+};
+}
+
+int main(int argc, char* argv[])
+{
+    int n = 1000000;
+
+    if (argc > 1)
+    {
+        n = std::atoi(argv[1]);
+    }
+
+    std::vector<Benchmark> benchmarks = {
+        { "basic", BenchmarkBasicOperations },
+        { "find_batch", BenchmarkFindBatch },
+        { "query_sorted", BenchmarkQuerySorted },
+        { "snapshot", BenchmarkSnapshot },
+        { "finger_insert", BenchmarkFingerInsert },
+        { "priority_queue", BenchmarkPriorityQueue },
+        { "node_handle", BenchmarkNodeHandle },
+        { "small_set", BenchmarkSmallSet },
+        { "roaring", BenchmarkRoaring },
+        { "y_fast_trie", BenchmarkYFastTrie },
+        { "btree", BenchmarkBTree },
+        { "skip_list", BenchmarkSkipList },
+        { "weak_avl", BenchmarkWeakAVL },
+        { "relaxed", BenchmarkRelaxedBalance },
+        { "freeze", BenchmarkFreeze },
+        { "compact", BenchmarkCompact },
+        { "filter", BenchmarkMembershipFilter },
+        { "hash_index", BenchmarkHashIndex },
+        { "hot_key", BenchmarkHotKeyCache },
+        { "augment", BenchmarkAugmentation },
+        { "map", BenchmarkMap },
+        { "range_add", BenchmarkRangeAdd },
+        { "wal", BenchmarkWriteAheadLog },
+    };
+
+    PerfCounter perf_counter;
+
+    if (!perf_counter.IsAvailable())
+    {
+        std::cout << "perf_event_open is not available; reporting wall-clock time only\n";
+    }
+
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        bool selected = (argc <= 2);
+
+        for (int i = 2; i < argc; i++)
+        {
+            if (benchmark.name == std::string(argv[i]))
+            {
+                selected = true;
+            }
+        }
+
+        if (selected)
+        {
+            std::cout << "== " << benchmark.name << " (n=" << n << ")\n";
+            benchmark.function(n);
+        }
+    }
+
+    std::cout << "checksum " << sink << "\n";
+
+    return 0;
+}
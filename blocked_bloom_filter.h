@@ -0,0 +1,82 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef BLOCKED_BLOOM_FILTER_H
+#define BLOCKED_BLOOM_FILTER_H
+
+#include "set_hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// SetAVL의 Find 앞에 두는 근사 membership filter (split block Bloom filter)
+// key마다 64byte(cache line 하나) block 하나를 고르고, block의 64bit word 8개에 bit를 하나씩 설정함
+// 그래서 Add와 MayContain은 cache line 하나만 읽고 branch 없이 8개의 word를 한 번에 검사함
+// MayContain이 false이면 key는 확실히 없고, true이면 있을 수도 있음 (false positive)
+// bit를 지울 수 없으므로 Set에서 삭제된 key는 stale로 세어두고, NeedsRebuild이면 다시 만들어야 함
+template <typename T>
+class BlockedBloomFilter
+{
+public:
+    BlockedBloomFilter() : capacity_(0), key_count_(0), stale_count_(0) {}
+
+    // key를 capacity개까지 key 하나당 bits_per_key bit로 담을 수 있도록 비우고 다시 할당
+    // bits_per_key가 10이면 capacity개를 담았을 때 false positive 비율은 약 1%
+    void Reset(int capacity, int bits_per_key);
+
+    // key를 filter에 담음
+    void Add(const T& key);
+
+    // key가 담겨있을 수 있으면 true (Reset하기 전이면 항상 true)
+    bool MayContain(const T& key) const;
+
+    // Set에서 삭제된 key의 개수를 하나 늘림 (bit는 그대로 남음)
+    void MarkErased() { stale_count_++; }
+
+    // capacity보다 많은 key가 담겼거나 삭제된 key가 담긴 key의 절반을 넘어서
+    // false positive 비율이 처음보다 커졌으면 true
+    bool NeedsRebuild() const { return key_count_ > capacity_ || 2 * stale_count_ > key_count_; }
+
+    // Reset 이후 담은 key의 개수와 그 중 삭제된 key의 개수
+    int GetKeyCount() const { return key_count_; }
+    int GetStaleCount() const { return stale_count_; }
+
+    // Reset할 때 정한 key의 개수
+    int GetCapacity() const { return capacity_; }
+
+    // block 배열이 사용하는 byte 수
+    std::size_t GetMemoryBytes() const { return sizeof(*this) + blocks_.capacity() * sizeof(Block); }
+private:
+    // block 하나의 word 개수 (word마다 bit 하나를 설정)
+    static constexpr int kWordsPerBlock = 8;
+
+    struct alignas(64) Block
+    {
+        std::uint64_t words[kWordsPerBlock];
+    };
+
+    // hash의 상위 32bit로 block을 고름
+    std::size_t GetBlockIndex(std::uint64_t hash) const;
+
+    // hash의 하위 32bit로 word마다 설정할 bit를 만듦
+    static void MakeMask(std::uint64_t hash, std::uint64_t* out_mask);
+
+    std::vector<Block> blocks_;
+
+    int capacity_;
+    int key_count_;
+    int stale_count_;
+};
+
+#include "blocked_bloom_filter.hpp"
+
+#endif
@@ -0,0 +1,101 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "blocked_bloom_filter.h"
+
+#include <algorithm>
+
+// key를 capacity개까지 key 하나당 bits_per_key bit로 담을 수 있도록 비우고 다시 할당
+template <typename T>
+void BlockedBloomFilter<T>::Reset(int capacity, int bits_per_key)
+{
+    const long long bits = static_cast<long long>(std::max(capacity, 1)) * std::max(bits_per_key, 1);
+    const long long block_bits = kWordsPerBlock * 64;
+    const std::size_t block_count = static_cast<std::size_t>((bits + block_bits - 1) / block_bits);
+
+    blocks_.assign(block_count, Block());
+    capacity_ = capacity;
+    key_count_ = 0;
+    stale_count_ = 0;
+}
+
+// key를 filter에 담음
+template <typename T>
+void BlockedBloomFilter<T>::Add(const T& key)
+{
+    if (blocks_.empty())
+    {
+        return;
+    }
+
+    const std::uint64_t hash = SetHashKey(key);
+    std::uint64_t mask[kWordsPerBlock];
+    MakeMask(hash, mask);
+
+    Block& block = blocks_[GetBlockIndex(hash)];
+
+    for (int i = 0; i < kWordsPerBlock; i++)
+    {
+        block.words[i] |= mask[i];
+    }
+
+    key_count_++;
+}
+
+// key가 담겨있을 수 있으면 true
+template <typename T>
+bool BlockedBloomFilter<T>::MayContain(const T& key) const
+{
+    if (blocks_.empty())
+    {
+        return true;
+    }
+
+    const std::uint64_t hash = SetHashKey(key);
+    std::uint64_t mask[kWordsPerBlock];
+    MakeMask(hash, mask);
+
+    const Block& block = blocks_[GetBlockIndex(hash)];
+
+    // word별로 비어있는 bit를 모아서 한 번만 비교함 (compiler가 vector 연산으로 바꿀 수 있음)
+    std::uint64_t missing = 0;
+
+    for (int i = 0; i < kWordsPerBlock; i++)
+    {
+        missing |= mask[i] & ~block.words[i];
+    }
+
+    return missing == 0;
+}
+
+// hash의 상위 32bit로 block을 고름 (나눗셈 대신 곱셈으로 [0, block 개수) 범위로 줄임)
+template <typename T>
+std::size_t BlockedBloomFilter<T>::GetBlockIndex(std::uint64_t hash) const
+{
+    return static_cast<std::size_t>(((hash >> 32) * blocks_.size()) >> 32);
+}
+
+// hash의 하위 32bit에 word마다 다른 홀수를 곱한 값의 상위 6bit를 해당 word의 bit 위치로 사용
+template <typename T>
+void BlockedBloomFilter<T>::MakeMask(std::uint64_t hash, std::uint64_t* out_mask)
+{
+    static constexpr std::uint32_t kSalts[kWordsPerBlock] = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+    };
+
+    const std::uint32_t low = static_cast<std::uint32_t>(hash);
+
+    for (int i = 0; i < kWordsPerBlock; i++)
+    {
+        out_mask[i] = std::uint64_t(1) << ((low * kSalts[i]) >> 26);
+    }
+}
@@ -0,0 +1,97 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef EPOCH_MANAGER_H
+#define EPOCH_MANAGER_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// lock-free 자료구조에서 제거한 node의 메모리를 안전하게 해제하기 위한 epoch 기반 회수기
+// 자료구조에 접근하는 thread는 Guard를 만들어 현재 epoch에 들어가고,
+// 제거한 node는 Retire로 넘김
+// 모든 active thread가 다음 epoch로 넘어간 뒤 한 epoch가 더 지나면
+// 그 node를 읽고 있는 thread가 없으므로 해제함
+class EpochManager
+{
+public:
+    // 동시에 Guard를 사용할 수 있는 최대 thread 개수
+    static constexpr int kMaxThreads = 128;
+
+    EpochManager() : global_epoch_(0) {}
+
+    // 아직 해제하지 않은 node를 모두 해제 (다른 thread가 사용하지 않을 때 소멸되어야 함)
+    ~EpochManager();
+
+    // 생성부터 소멸까지 현재 thread가 epoch에 들어가 있음 (같은 thread에서 중첩 가능)
+    class Guard
+    {
+    public:
+        explicit Guard(EpochManager& manager);
+        ~Guard();
+    private:
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        EpochManager& manager_;
+        int slot_;
+    };
+
+    // 자료구조에서 더 이상 도달할 수 없는 pointer를 넘김 (Guard 안에서 호출)
+    // 안전해지면 deleter(pointer)로 해제함
+    void Retire(void* pointer, void (*deleter)(void*));
+private:
+    // thread가 한 번에 모아두는 retire 개수 (넘으면 epoch을 넘기고 해제를 시도함)
+    static constexpr std::size_t kReclaimThreshold = 64;
+
+    struct RetiredPointer
+    {
+        std::uint64_t epoch;
+        void* pointer;
+        void (*deleter)(void*);
+    };
+
+    // thread별 상태 (false sharing을 막기 위해 cache line 단위로 정렬)
+    struct alignas(64) ThreadRecord
+    {
+        ThreadRecord() : epoch(0), active(false), nesting(0) {}
+
+        std::atomic<std::uint64_t> epoch;
+        std::atomic<bool> active;
+
+        // 아래는 slot을 가진 thread만 사용
+        int nesting;
+        std::vector<RetiredPointer> retired;
+    };
+
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+
+    // 현재 thread의 slot 번호 (thread가 처음 호출할 때 빈 slot을 받고 종료할 때 반납)
+    static int GetThreadSlot();
+
+    // 모든 active thread가 현재 epoch에 있으면 global epoch를 하나 올림
+    void TryAdvance();
+
+    // record에 모인 pointer 중 안전해진 것을 해제
+    void Reclaim(ThreadRecord& record);
+
+    // global epoch
+    std::atomic<std::uint64_t> global_epoch_;
+
+    // slot별 thread 상태
+    ThreadRecord records_[kMaxThreads];
+};
+
+#include "epoch_manager.hpp"
+
+#endif
@@ -0,0 +1,149 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "epoch_manager.h"
+
+#include <cstdlib>
+#include <thread>
+
+// 아직 해제하지 않은 node를 모두 해제
+inline EpochManager::~EpochManager()
+{
+    for (ThreadRecord& record : records_)
+    {
+        for (const RetiredPointer& retired : record.retired)
+        {
+            retired.deleter(retired.pointer);
+        }
+
+        record.retired.clear();
+    }
+}
+
+// 현재 thread를 epoch에 들어가게 함
+inline EpochManager::Guard::Guard(EpochManager& manager)
+    : manager_(manager), slot_(GetThreadSlot())
+{
+    ThreadRecord& record = manager_.records_[slot_];
+
+    if (record.nesting++ == 0)
+    {
+        // active를 먼저 알린 뒤 epoch를 읽으므로,
+        // TryAdvance가 이 thread를 보지 못했다면 이 thread는 넘어간 epoch를 읽음
+        record.active.store(true);
+        record.epoch.store(manager_.global_epoch_.load());
+    }
+}
+
+// 현재 thread를 epoch에서 나오게 함
+inline EpochManager::Guard::~Guard()
+{
+    ThreadRecord& record = manager_.records_[slot_];
+
+    if (--record.nesting == 0)
+    {
+        record.active.store(false);
+    }
+}
+
+// 더 이상 도달할 수 없는 pointer를 넘김
+inline void EpochManager::Retire(void* pointer, void (*deleter)(void*))
+{
+    ThreadRecord& record = records_[GetThreadSlot()];
+
+    record.retired.push_back({ global_epoch_.load(), pointer, deleter });
+
+    if (record.retired.size() >= kReclaimThreshold)
+    {
+        TryAdvance();
+        Reclaim(record);
+    }
+}
+
+// 현재 thread의 slot 번호
+inline int EpochManager::GetThreadSlot()
+{
+    static std::atomic<bool> slot_used[kMaxThreads] = {};
+
+    // thread가 처음 사용할 때 빈 slot을 찾고, thread가 종료되면 반납
+    struct ThreadSlot
+    {
+        ThreadSlot() : index(-1)
+        {
+            while (index == -1)
+            {
+                for (int i = 0; i < kMaxThreads; i++)
+                {
+                    bool expected = false;
+
+                    if (slot_used[i].compare_exchange_strong(expected, true))
+                    {
+                        index = i;
+                        break;
+                    }
+                }
+
+                if (index == -1)
+                {
+                    // 모든 slot을 사용 중이면 다른 thread가 종료될 때까지 기다림
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        ~ThreadSlot() { slot_used[index].store(false); }
+
+        int index;
+    };
+
+    thread_local ThreadSlot slot;
+
+    return slot.index;
+}
+
+// 모든 active thread가 현재 epoch에 있으면 global epoch를 하나 올림
+inline void EpochManager::TryAdvance()
+{
+    std::uint64_t epoch = global_epoch_.load();
+
+    for (const ThreadRecord& record : records_)
+    {
+        if (record.active.load() && record.epoch.load() != epoch)
+        {
+            return;
+        }
+    }
+
+    global_epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+// record에 모인 pointer 중 안전해진 것을 해제
+// epoch e에 retire한 pointer는 global epoch가 e + 2 이상이 되면
+// 그 pointer를 읽을 수 있었던 thread가 모두 Guard를 벗어난 것이 보장됨
+inline void EpochManager::Reclaim(ThreadRecord& record)
+{
+    const std::uint64_t epoch = global_epoch_.load();
+    std::size_t kept = 0;
+
+    for (std::size_t i = 0; i < record.retired.size(); i++)
+    {
+        if (record.retired[i].epoch + 2 <= epoch)
+        {
+            record.retired[i].deleter(record.retired[i].pointer);
+        }
+        else
+        {
+            record.retired[kept++] = record.retired[i];
+        }
+    }
+
+    record.retired.resize(kept);
+}
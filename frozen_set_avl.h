@@ -0,0 +1,92 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef FROZEN_SET_AVL_H
+#define FROZEN_SET_AVL_H
+
+#include <cstddef>
+#include <vector>
+
+// SetAVL::Freeze로 만드는 읽기 전용 Set
+// key를 Eytzinger(BFS) 순서로 하나의 연속된 배열에 저장하므로 pointer가 없음
+//   keys_[1]이 root node이고 keys_[k]의 left child는 keys_[2k], right child는 keys_[2k + 1]
+//   (원소 n개로 만들 수 있는 가장 낮은 complete binary search tree)
+// 탐색은 branch 없이 k = 2k + (keys_[k] < key)로 내려가며,
+// 4단계 아래의 자손 16개가 연속으로 놓여 있으므로 그 위치를 미리 prefetch함
+// depth는 이 배열이 나타내는 tree에서의 depth이고, rank는 node의 위치로부터 계산함
+template <typename T>
+class FrozenSetAVL
+{
+public:
+    FrozenSetAVL() : size_(0), height_(-1), keys_(1) {}
+
+    // 오름차순으로 정렬되고 중복이 없는 [first, last)의 key로 생성
+    template <typename Iterator>
+    FrozenSetAVL(Iterator first, Iterator last);
+
+    // Set이 비어있으면 1, 그렇지 않으면 0을 return
+    bool IsEmpty() const { return size_ == 0; }
+
+    // Set에 들어있는 원소의 개수 return
+    int GetSize() const { return size_; }
+
+    // 해당 key를 가지고 있는 node의 depth를 return (없으면 -1)
+    int Find(const T& key) const;
+
+    // key가 Set에 들어있으면 true
+    bool Contains(const T& key) const { return FindIndex(key) != 0; }
+
+    // key를 root로 하는 subtree에서 최솟값, 최댓값을 갖는 node의 값과 depth를 출력
+    void Minimum(const T& key) const;
+    void Maximum(const T& key) const;
+
+    // 해당 key를 가지고 있는 node의 depth와 rank를 출력
+    // rank: Set에서 해당 key보다 작은 key의 개수 + 1
+    void Rank(const T& key) const;
+
+    // 해당 key의 rank를 return (없으면 0)
+    int GetRank(const T& key) const;
+
+    // key 배열이 사용하는 byte 수
+    std::size_t GetMemoryBytes() const { return sizeof(*this) + keys_.capacity() * sizeof(T); }
+private:
+    // 한 번에 prefetch하는 자손의 단계 수 (2^4 = 16개의 자손이 연속으로 놓임)
+    static constexpr int kPrefetchLevels = 4;
+
+    // current부터 차례로 읽은 key를 위치 index를 root로 하는 subtree에 중위 순회 순서로 채움
+    template <typename Iterator>
+    void Fill(int index, Iterator& current);
+
+    // key 이상인 첫 node의 위치 (없으면 0)
+    int LowerBound(const T& key) const;
+
+    // key를 가진 node의 위치 (없으면 0)
+    int FindIndex(const T& key) const;
+
+    // 위치 index의 node의 depth
+    static int GetDepth(int index);
+
+    // 위치 index의 node가 오름차순에서 몇 번째 원소인지 (0부터 시작)
+    int GetInorderIndex(int index) const;
+
+    // Set에 들어있는 원소의 개수
+    int size_;
+
+    // tree의 height (floor(log2(size_)), 비어있으면 -1)
+    int height_;
+
+    // Eytzinger 순서의 key (keys_[0]은 사용하지 않음)
+    std::vector<T> keys_;
+};
+
+#include "frozen_set_avl.hpp"
+
+#endif
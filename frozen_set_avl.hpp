@@ -0,0 +1,178 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "frozen_set_avl.h"
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+
+// 오름차순으로 정렬되고 중복이 없는 [first, last)의 key로 생성
+template <typename T>
+template <typename Iterator>
+FrozenSetAVL<T>::FrozenSetAVL(Iterator first, Iterator last) :
+    size_(static_cast<int>(std::distance(first, last))),
+    height_((size_ == 0) ? -1 : GetDepth(size_)), keys_(size_ + 1)
+{
+    Fill(1, first);
+}
+
+// 해당 key를 가지고 있는 node의 depth를 return
+template <typename T>
+int FrozenSetAVL<T>::Find(const T& key) const
+{
+    int index = FindIndex(key);
+
+    return (index == 0) ? -1 : GetDepth(index);
+}
+
+// key를 root로 하는 subtree에서 최솟값을 갖는 node의 값과 depth를 출력
+template <typename T>
+void FrozenSetAVL<T>::Minimum(const T& key) const
+{
+    int index = FindIndex(key);
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (index == 0)
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    // left child가 있는 동안 내려감
+    while (2 * index <= size_)
+    {
+        index = 2 * index;
+    }
+
+    std::cout << keys_[index] << " " << GetDepth(index) << "\n";
+}
+
+// key를 root로 하는 subtree에서 최댓값을 갖는 node의 값과 depth를 출력
+template <typename T>
+void FrozenSetAVL<T>::Maximum(const T& key) const
+{
+    int index = FindIndex(key);
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (index == 0)
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    // right child가 있는 동안 내려감
+    while (2 * index + 1 <= size_)
+    {
+        index = 2 * index + 1;
+    }
+
+    std::cout << keys_[index] << " " << GetDepth(index) << "\n";
+}
+
+// 해당 key를 가지고 있는 node의 depth와 rank를 출력
+template <typename T>
+void FrozenSetAVL<T>::Rank(const T& key) const
+{
+    int index = FindIndex(key);
+
+    if (index == 0)
+    {
+        std::cout << "0\n";
+        return;
+    }
+
+    std::cout << GetDepth(index) << " " << GetInorderIndex(index) + 1;
+}
+
+// 해당 key의 rank를 return (없으면 0)
+template <typename T>
+int FrozenSetAVL<T>::GetRank(const T& key) const
+{
+    int index = FindIndex(key);
+
+    return (index == 0) ? 0 : GetInorderIndex(index) + 1;
+}
+
+// current부터 차례로 읽은 key를 위치 index를 root로 하는 subtree에 중위 순회 순서로 채움
+// 재귀의 깊이는 tree의 height + 1
+template <typename T>
+template <typename Iterator>
+void FrozenSetAVL<T>::Fill(int index, Iterator& current)
+{
+    if (index > size_)
+    {
+        return;
+    }
+
+    Fill(2 * index, current);
+    keys_[index] = *current;
+    ++current;
+    Fill(2 * index + 1, current);
+}
+
+// key 이상인 첫 node의 위치 (없으면 0)
+// 마지막까지 branch 없이 내려간 뒤, 위치의 이진 표현에서 마지막으로 오른쪽으로 간 지점을 찾음
+// (끝의 1인 bit들과 그 앞의 0인 bit 하나를 지우면 마지막으로 왼쪽으로 간 node의 위치)
+template <typename T>
+int FrozenSetAVL<T>::LowerBound(const T& key) const
+{
+    const T* keys = keys_.data();
+    unsigned int index = 1;
+
+    while (index <= static_cast<unsigned int>(size_))
+    {
+        __builtin_prefetch(keys + (index << kPrefetchLevels));
+        index = 2 * index + static_cast<unsigned int>(keys[index] < key);
+    }
+
+    return static_cast<int>(index >> __builtin_ffs(static_cast<int>(~index)));
+}
+
+// key를 가진 node의 위치 (없으면 0)
+template <typename T>
+int FrozenSetAVL<T>::FindIndex(const T& key) const
+{
+    int index = LowerBound(key);
+
+    if ((index == 0) || (key < keys_[index]))
+    {
+        return 0;
+    }
+
+    return index;
+}
+
+// 위치 index의 node의 depth (root node의 depth를 0으로 정의)
+template <typename T>
+int FrozenSetAVL<T>::GetDepth(int index)
+{
+    return 31 - __builtin_clz(static_cast<unsigned int>(index));
+}
+
+// 위치 index의 node가 오름차순에서 몇 번째 원소인지 (0부터 시작)
+// 마지막 level까지 가득 찬 tree에서의 순서를 구한 뒤,
+// 그 앞에 있어야 할 마지막 level의 빈 자리 개수를 뺌
+// (가득 찬 tree에서 마지막 level의 node는 짝수 번째에 놓임)
+template <typename T>
+int FrozenSetAVL<T>::GetInorderIndex(int index) const
+{
+    const int depth = GetDepth(index);
+    const int offset = index - (1 << depth);
+    const long long full_index =
+        (2LL * offset + 1) * (1LL << (height_ - depth)) - 1;
+
+    // 마지막 level에 실제로 있는 node의 개수
+    const long long last_level_count = size_ - ((1LL << height_) - 1);
+    const long long missing_count = std::max(0LL, (full_index + 1) / 2 - last_level_count);
+
+    return static_cast<int>(full_index - missing_count);
+}
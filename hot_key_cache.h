@@ -0,0 +1,101 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef HOT_KEY_CACHE_H
+#define HOT_KEY_CACHE_H
+
+#include "node_avl.h"
+#include "set_hash.h"
+
+#include <cstdint>
+#include <vector>
+
+// HotKeyCache의 조회 결과에 대한 통계
+struct HotKeyCacheStats
+{
+    // 저장된 결과를 그대로 사용한 횟수
+    long long hit_count;
+
+    // key는 있었지만 tree 모양이 바뀌어서 node로부터 depth, rank를 다시 계산한 횟수
+    long long stale_hit_count;
+
+    // key가 cache에 없어서 tree를 탐색한 횟수
+    long long miss_count;
+};
+
+// SetAVL에서 최근에 찾은 key의 (node, depth, rank)를 저장하는 direct-mapped cache
+// key의 hash로 정해지는 slot 하나에만 저장하므로 조회는 slot 하나를 읽는 것으로 끝남
+// 저장할 때의 tree version을 함께 기록하고, SetAVL은 tree 모양이 바뀔 때마다 version을 올려서
+// 모든 slot의 depth, rank를 한 번에 무효화함 (node는 삭제될 때까지 유효하므로 Erase로 해당 slot만 비움)
+// 한 번만 찾는 key가 자주 찾는 key를 밀어내지 않도록 CLOCK처럼 slot마다 참조 bit를 두고,
+// 참조 bit가 켜진 slot은 다른 key를 저장하려고 할 때 bit만 끄고 한 번 더 남겨둠
+template <typename T>
+class HotKeyCache
+{
+public:
+    struct Entry
+    {
+        T key;
+
+        // key를 가진 node (빈 slot이면 nullptr)
+        NodeAVL<T>* node;
+
+        int depth;
+
+        // 아직 계산하지 않았으면 0
+        int rank;
+
+        // depth, rank를 계산할 때의 tree version
+        std::uint64_t version;
+
+        // Store 이후 Lookup으로 사용되었는지 여부
+        bool referenced;
+    };
+
+    HotKeyCache() : mask_(0), stats_{ 0, 0, 0 } {}
+
+    // 모든 slot을 비우고 slot의 개수를 slot_count 이상인 가장 작은 2의 거듭제곱으로 맞춤
+    void Reset(int slot_count);
+
+    // key가 저장된 slot을 return하고 hit, stale hit, miss를 셈 (없으면 nullptr)
+    // 저장된 version이 version과 다르면 depth, rank는 더 이상 맞지 않음
+    Entry* Lookup(const T& key, std::uint64_t version);
+
+    // node의 key가 들어갈 slot에 node, depth, rank를 저장
+    // slot에 참조 bit가 켜진 다른 key가 있으면 bit만 끄고 저장하지 않음
+    void Store(NodeAVL<T>* node, int depth, int rank, std::uint64_t version);
+
+    // node가 저장되어 있으면 해당 slot을 비움 (node를 해제하거나 옮기기 전에 호출)
+    void Erase(const NodeAVL<T>* node);
+
+    // 모든 slot을 비움 (통계는 유지)
+    void Clear();
+
+    HotKeyCacheStats GetStats() const { return stats_; }
+    void ResetStats() { stats_ = HotKeyCacheStats{ 0, 0, 0 }; }
+
+    // slot의 개수
+    int GetSlotCount() const { return static_cast<int>(entries_.size()); }
+private:
+    // key가 들어갈 slot의 위치
+    std::size_t GetSlotIndex(const T& key) const { return SetHashKey(key) & mask_; }
+
+    std::vector<Entry> entries_;
+
+    // slot의 개수 - 1
+    std::size_t mask_;
+
+    HotKeyCacheStats stats_;
+};
+
+#include "hot_key_cache.hpp"
+
+#endif
@@ -0,0 +1,104 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "hot_key_cache.h"
+
+// 모든 slot을 비우고 slot의 개수를 slot_count 이상인 가장 작은 2의 거듭제곱으로 맞춤
+template <typename T>
+void HotKeyCache<T>::Reset(int slot_count)
+{
+    std::size_t size = 1;
+
+    while (size < static_cast<std::size_t>(slot_count))
+    {
+        size *= 2;
+    }
+
+    entries_.assign(size, Entry{ T(), nullptr, 0, 0, 0, false });
+    mask_ = size - 1;
+}
+
+// key가 저장된 slot을 return하고 hit, stale hit, miss를 셈
+template <typename T>
+typename HotKeyCache<T>::Entry* HotKeyCache<T>::Lookup(const T& key, std::uint64_t version)
+{
+    if (!entries_.empty())
+    {
+        Entry& entry = entries_[GetSlotIndex(key)];
+
+        if (entry.node != nullptr && entry.key == key)
+        {
+            entry.referenced = true;
+
+            if (entry.version == version)
+            {
+                stats_.hit_count++;
+            }
+            else
+            {
+                stats_.stale_hit_count++;
+            }
+
+            return &entry;
+        }
+    }
+
+    stats_.miss_count++;
+    return nullptr;
+}
+
+// node의 key가 들어갈 slot에 node, depth, rank를 저장
+template <typename T>
+void HotKeyCache<T>::Store(NodeAVL<T>* node, int depth, int rank, std::uint64_t version)
+{
+    if (entries_.empty())
+    {
+        return;
+    }
+
+    const T key = node->GetKey();
+    Entry& entry = entries_[GetSlotIndex(key)];
+
+    if (entry.node != nullptr && entry.referenced)
+    {
+        entry.referenced = false;
+        return;
+    }
+
+    entry = Entry{ key, node, depth, rank, version, false };
+}
+
+// node가 저장되어 있으면 해당 slot을 비움
+template <typename T>
+void HotKeyCache<T>::Erase(const NodeAVL<T>* node)
+{
+    if (entries_.empty())
+    {
+        return;
+    }
+
+    Entry& entry = entries_[GetSlotIndex(node->GetKey())];
+
+    if (entry.node == node)
+    {
+        entry.node = nullptr;
+    }
+}
+
+// 모든 slot을 비움
+template <typename T>
+void HotKeyCache<T>::Clear()
+{
+    for (Entry& entry : entries_)
+    {
+        entry.node = nullptr;
+    }
+}
@@ -9,15 +9,27 @@
  * Latest Updated on 2023-12-15
 **************************************************/
 
+#include "perf_counter.h"
 #include "set_avl.h"
 #include <iostream>
+#include <string>
 
-int main()
+int main(int argc, char* argv[])
 {
     std::ios_base::sync_with_stdio(false);
     std::cin.tie(NULL);
     std::cout.tie(NULL);
 
+    // --perf 옵션이 주어지면 전체 명령 처리 구간의 하드웨어 카운터를 stderr에 출력
+    bool measure_perf = (argc > 1 && std::string(argv[1]) == "--perf");
+    PerfCounter perf_counter;
+    long long operations = 0;
+
+    if (measure_perf)
+    {
+        perf_counter.Start();
+    }
+
     int T;
     std::cin >> T;
 
@@ -25,6 +37,7 @@ int main()
     {
         int Q;
         std::cin >> Q;
+        operations += Q;
 
         SetAVL<int> set;
 
@@ -101,6 +114,14 @@ int main()
             }
         }
     }
+
+    if (measure_perf)
+    {
+        perf_counter.Stop();
+        std::cerr << "operations=" << operations;
+        perf_counter.PrintPerOperation(std::cerr, operations);
+        std::cerr << "\n";
+    }
     
     return 0;
 }
@@ -0,0 +1,121 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef MAP_AVL_H
+#define MAP_AVL_H
+
+#include "node_map_avl.h"
+#include "set_avl.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// SetAVL의 node에 value를 함께 저장하게 만드는 Augmentation (aggregate는 없음)
+template <typename V>
+struct MapAVLValue
+{
+};
+
+template <typename K, typename V>
+struct SetAVLAugmentationTraits<K, MapAVLValue<V>>
+{
+    typedef MapNodeAVL<K, V> Node;
+    typedef SetAVLNoAugmentation Value;
+
+    static constexpr bool kEnabled = false;
+    static constexpr bool kLazy = false;
+    static constexpr bool kStoresValue = true;
+
+    static void Update(NodeAVL<K>*) {}
+    static void PushDown(NodeAVL<K>*) {}
+
+    // V에 기본 생성자가 없으면 SetAVL::Insert(key)로는 삽입할 수 없음 (nullptr)
+    static Node* Create(const K& key) { return Create(key, std::is_default_constructible<V>()); }
+    static Node* Create(const K& key, std::true_type) { return new Node(key); }
+    static Node* Create(const K&, std::false_type) { return nullptr; }
+
+    static Node* Clone(const NodeAVL<K>* source)
+    {
+        return new Node(source->GetKey(), static_cast<const Node*>(source)->GetValue());
+    }
+
+    static Node* Relocate(void* memory, NodeAVL<K>* source)
+    {
+        return new (memory) Node(source->GetKey(), std::move(static_cast<Node*>(source)->GetValue()));
+    }
+};
+
+// key마다 value를 가지는 정렬된 Map
+// SetAVL<K>의 node에 value를 저장하므로 삽입, 삭제, rebalancing은 SetAVL과 같은 코드를 사용하고,
+// 한 번의 탐색으로 key의 순서와 value를 함께 찾음 (SetAVL과 hash map을 따로 두지 않아도 됨)
+// value는 node가 삭제될 때까지 같은 자리에 있으므로 Find가 return한 pointer는
+// 해당 key를 Erase하거나 GetKeys()로 Compact, Extract를 호출하기 전까지 유효함
+template <typename K, typename V, typename BalancePolicy = AVLBalancePolicy>
+class MapAVL
+{
+public:
+    typedef SetAVL<K, BalancePolicy, MapAVLValue<V>> KeySet;
+
+    // Basic 기능
+    // Map이 비어있으면 1, 그렇지 않으면 0을 return
+    bool IsEmpty() const { return keys_.IsEmpty(); }
+
+    // Map에 들어있는 key의 개수 return
+    int GetSize() const { return keys_.GetSize(); }
+
+    // key에 연결된 value를 return (없으면 nullptr)
+    V* Find(const K& key) { return GetValue(FindNode(key)); }
+    const V* Find(const K& key) const { return GetValue(FindNode(key)); }
+
+    // key가 Map에 들어있으면 true
+    bool Contains(const K& key) const { return FindNode(key) != nullptr; }
+
+    // key가 없으면 value와 함께 삽입하고 true, 이미 있으면 value를 대입하고 false를 return
+    template <typename M>
+    bool InsertOrAssign(const K& key, M&& value);
+
+    // key가 없으면 args로 value를 node 안에서 바로 생성하여 삽입하고, 이미 있으면 아무것도 하지 않음
+    // 어느 경우든 key에 연결된 value를 return (임시 value 객체를 만들지 않음)
+    template <typename... Args>
+    V& TryEmplace(const K& key, Args&&... args);
+
+    // key와 value를 삭제하고 해당 노드의 depth를 return (없으면 -1)
+    int Erase(const K& key) { return keys_.Erase(key); }
+
+    // Map의 모든 key와 value를 삭제
+    void Clear() { keys_.Clear(); }
+
+    // key로 이루어진 SetAVL (depth, Rank, Compact, Extract 등 key의 순서와 tree 모양에 대한 기능에 사용)
+    // SetAVL::Insert로 삽입한 key의 value는 기본 생성자로 만들어짐 (기본 생성자가 없으면 삽입하지 않고 -1)
+    // 모든 value를 버리게 되는 AssignSorted, LoadSnapshot은 compile되지 않음
+    KeySet& GetKeys() { return keys_; }
+    const KeySet& GetKeys() const { return keys_; }
+private:
+    typedef MapNodeAVL<K, V> Node;
+
+    // key를 가진 node (없으면 nullptr)
+    Node* FindNode(const K& key) const;
+
+    // key를 가진 node를 찾고, 없으면 args로 만든 node를 삽입하여 return
+    // 새로 삽입했으면 out_inserted가 true
+    template <typename... Args>
+    Node* FindOrEmplaceNode(const K& key, bool& out_inserted, Args&&... args);
+
+    static V* GetValue(Node* node) { return (node == nullptr) ? nullptr : &node->GetValue(); }
+
+    // key와 value를 저장하는 SetAVL
+    KeySet keys_;
+};
+
+#include "map_avl.hpp"
+
+#endif
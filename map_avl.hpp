@@ -0,0 +1,76 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "map_avl.h"
+
+// key가 없으면 value와 함께 삽입하고, 이미 있으면 value를 대입
+template <typename K, typename V, typename BalancePolicy>
+template <typename M>
+bool MapAVL<K, V, BalancePolicy>::InsertOrAssign(const K& key, M&& value)
+{
+    bool inserted = false;
+    Node* node = FindOrEmplaceNode(key, inserted, std::forward<M>(value));
+
+    // 삽입하지 않았으면 value는 아직 사용되지 않았음
+    if (!inserted)
+    {
+        node->GetValue() = std::forward<M>(value);
+    }
+
+    return inserted;
+}
+
+// key가 없으면 args로 value를 생성하여 삽입
+template <typename K, typename V, typename BalancePolicy>
+template <typename... Args>
+V& MapAVL<K, V, BalancePolicy>::TryEmplace(const K& key, Args&&... args)
+{
+    bool inserted = false;
+
+    return FindOrEmplaceNode(key, inserted, std::forward<Args>(args)...)->GetValue();
+}
+
+// key를 가진 node를 찾음
+template <typename K, typename V, typename BalancePolicy>
+typename MapAVL<K, V, BalancePolicy>::Node* MapAVL<K, V, BalancePolicy>::FindNode(const K& key) const
+{
+    NodeAVL<K>* node = keys_.root_;
+
+    while (node != nullptr && !(key == node->GetKey()))
+    {
+        node = (key < node->GetKey()) ? node->GetLeft() : node->GetRight();
+    }
+
+    return static_cast<Node*>(node);
+}
+
+// key를 가진 node를 찾고, 없으면 삽입할 자리에 args로 만든 node를 연결
+template <typename K, typename V, typename BalancePolicy>
+template <typename... Args>
+typename MapAVL<K, V, BalancePolicy>::Node* MapAVL<K, V, BalancePolicy>::FindOrEmplaceNode(
+    const K& key, bool& out_inserted, Args&&... args)
+{
+    NodeAVL<K>* parent_node = nullptr;
+    bool is_left_child = false;
+
+    // 이미 있으면 FindInsertPosition이 parent_node에 해당 node를 돌려줌
+    if (keys_.root_ != nullptr && !keys_.FindInsertPosition(keys_.root_, key, parent_node, is_left_child))
+    {
+        out_inserted = false;
+        return static_cast<Node*>(parent_node);
+    }
+
+    Node* node = new Node(key, std::forward<Args>(args)...);
+    keys_.LinkNode(parent_node, is_left_child, node);
+    out_inserted = true;
+
+    return node;
+}
@@ -0,0 +1,164 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef MAP_RANGE_SUM_AVL_H
+#define MAP_RANGE_SUM_AVL_H
+
+#include "node_map_avl.h"
+#include "set_avl.h"
+
+#include <new>
+
+// SetAVL의 node에 value, subtree의 value의 합, 미뤄둔 더하기(tag)를 저장하게 만드는 Augmentation
+template <typename V>
+struct MapAVLRangeSumValue
+{
+};
+
+template <typename K, typename V>
+struct SetAVLAugmentationTraits<K, MapAVLRangeSumValue<V>>
+{
+    typedef RangeSumMapNodeAVL<K, V> Node;
+    typedef SetAVLNoAugmentation Value;
+
+    static constexpr bool kEnabled = false;
+    static constexpr bool kLazy = true;
+    static constexpr bool kStoresValue = true;
+
+    // node를 루트 노드로 하는 subtree의 value의 합 (node의 조상의 tag는 포함하지 않음)
+    static V GetSum(const NodeAVL<K>* node)
+    {
+        return (node == nullptr) ? V() : static_cast<const Node*>(node)->GetSum();
+    }
+
+    // node를 루트 노드로 하는 subtree의 모든 value에 delta를 더함 (tag에 기록만 하므로 O(1))
+    static void AddToSubtree(NodeAVL<K>* node, const V& delta)
+    {
+        if (node == nullptr)
+        {
+            return;
+        }
+
+        Node* range_node = static_cast<Node*>(node);
+        range_node->SetTag(range_node->GetTag() + delta);
+        range_node->SetSum(range_node->GetSum() + delta * node->GetSize());
+    }
+
+    // node의 tag가 남아있어도 sum에 tag * size를 포함하므로 맞는 값을 계산함
+    static void Update(NodeAVL<K>* node)
+    {
+        Node* range_node = static_cast<Node*>(node);
+        range_node->SetSum(GetSum(node->GetLeft()) + range_node->GetValue() + GetSum(node->GetRight())
+            + range_node->GetTag() * node->GetSize());
+    }
+
+    // node의 tag를 node의 value와 두 child의 tag로 옮김 (node의 sum은 그대로)
+    static void PushDown(NodeAVL<K>* node)
+    {
+        Node* range_node = static_cast<Node*>(node);
+        const V tag = range_node->GetTag();
+
+        if (tag == V())
+        {
+            return;
+        }
+
+        range_node->GetValue() += tag;
+        AddToSubtree(node->GetLeft(), tag);
+        AddToSubtree(node->GetRight(), tag);
+        range_node->SetTag(V());
+    }
+
+    static Node* Create(const K& key) { return new Node(key); }
+
+    static Node* Clone(const NodeAVL<K>* source)
+    {
+        const Node* source_node = static_cast<const Node*>(source);
+        Node* node = new Node(source->GetKey(), source_node->GetValue());
+        node->SetSum(source_node->GetSum());
+        node->SetTag(source_node->GetTag());
+
+        return node;
+    }
+
+    static Node* Relocate(void* memory, NodeAVL<K>* source)
+    {
+        const Node* source_node = static_cast<const Node*>(source);
+        Node* node = new (memory) Node(source->GetKey(), source_node->GetValue());
+        node->SetSum(source_node->GetSum());
+        node->SetTag(source_node->GetTag());
+
+        return node;
+    }
+};
+
+// key마다 더하기가 가능한 value(정수, 실수)를 가지는 정렬된 Map
+// [lo, hi]의 모든 value에 delta를 더하는 AddRange와 [lo, hi]의 value의 합을 구하는 SumRange를 O(log n)에 처리함
+// AddRange는 범위 안의 subtree를 통째로 만나면 그 root의 tag에만 기록하고 내려가지 않으며,
+// tag는 Insert, Erase, rotation으로 해당 node의 자식이 바뀌기 직전에 자식에게 내려보냄
+// (SetAVL과 같은 삽입, 삭제, rebalancing 코드를 사용하고 Augmentation의 PushDown만 추가로 호출됨)
+template <typename K, typename V, typename BalancePolicy = AVLBalancePolicy>
+class MapRangeSumAVL
+{
+public:
+    typedef SetAVL<K, BalancePolicy, MapAVLRangeSumValue<V>> KeySet;
+
+    // Basic 기능
+    // Map이 비어있으면 1, 그렇지 않으면 0을 return
+    bool IsEmpty() const { return keys_.IsEmpty(); }
+
+    // Map에 들어있는 key의 개수 return
+    int GetSize() const { return keys_.GetSize(); }
+
+    // key에 연결된 value를 out_value에 저장 (없으면 false를 return하고 out_value는 변하지 않음)
+    // 내려가면서 만난 조상의 tag를 더하므로 tree를 바꾸지 않음
+    bool Find(const K& key, V& out_value) const;
+
+    // key가 Map에 들어있으면 true
+    bool Contains(const K& key) const { return keys_.Contains(key); }
+
+    // key가 없으면 value와 함께 삽입하고 true, 이미 있으면 value를 대입하고 false를 return
+    bool InsertOrAssign(const K& key, const V& value);
+
+    // key와 value를 삭제하고 해당 노드의 depth를 return (없으면 -1)
+    int Erase(const K& key) { return keys_.Erase(key); }
+
+    // Map의 모든 key와 value를 삭제
+    void Clear() { keys_.Clear(); }
+
+    // Range 기능
+    // key가 [lo, hi]에 들어있는 모든 value에 delta를 더함
+    void AddRange(const K& lo, const K& hi, const V& delta);
+
+    // key가 [lo, hi]에 들어있는 value의 합 (빈 범위이면 V())
+    V SumRange(const K& lo, const K& hi) const;
+
+    // key로 이루어진 SetAVL (depth, Rank, Compact 등 key의 순서와 tree 모양에 대한 기능에 사용)
+    // SetAVL::Insert로 삽입한 key의 value는 V() (모든 value를 버리게 되는 AssignSorted, LoadSnapshot은 compile되지 않음)
+    KeySet& GetKeys() { return keys_; }
+    const KeySet& GetKeys() const { return keys_; }
+private:
+    typedef SetAVLAugmentationTraits<K, MapAVLRangeSumValue<V>> Traits;
+    typedef RangeSumMapNodeAVL<K, V> Node;
+
+    static const Node* AsNode(const NodeAVL<K>* node) { return static_cast<const Node*>(node); }
+
+    // lo와 hi 사이로 처음 들어오는 node(split node)를 찾음 (없으면 nullptr)
+    // out_pending에는 split node의 조상의 tag의 합을 저장
+    NodeAVL<K>* FindSplitNode(const K& lo, const K& hi, V& out_pending) const;
+
+    // key와 value를 저장하는 SetAVL
+    KeySet keys_;
+};
+
+#include "map_range_sum_avl.hpp"
+
+#endif
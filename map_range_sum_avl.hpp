@@ -0,0 +1,211 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "map_range_sum_avl.h"
+
+// key에 연결된 value를 찾음
+template <typename K, typename V, typename BalancePolicy>
+bool MapRangeSumAVL<K, V, BalancePolicy>::Find(const K& key, V& out_value) const
+{
+    // 지나온 조상의 tag의 합
+    V pending = V();
+    const NodeAVL<K>* node = keys_.root_;
+
+    while (node != nullptr && !(key == node->GetKey()))
+    {
+        pending += AsNode(node)->GetTag();
+        node = (key < node->GetKey()) ? node->GetLeft() : node->GetRight();
+    }
+
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    out_value = AsNode(node)->GetValue() + AsNode(node)->GetTag() + pending;
+
+    return true;
+}
+
+// key가 없으면 value와 함께 삽입하고, 이미 있으면 value를 대입
+template <typename K, typename V, typename BalancePolicy>
+bool MapRangeSumAVL<K, V, BalancePolicy>::InsertOrAssign(const K& key, const V& value)
+{
+    NodeAVL<K>* parent_node = nullptr;
+    bool is_left_child = false;
+
+    if (keys_.root_ == nullptr || keys_.FindInsertPosition(keys_.root_, key, parent_node, is_left_child))
+    {
+        keys_.LinkNode(parent_node, is_left_child, new Node(key, value));
+        return true;
+    }
+
+    // 이미 있으면 parent_node가 해당 node이며, 조상과 node의 tag를 내려보내서
+    // node에 저장된 value가 실제 value가 되게 한 뒤 대입하고 root까지 합을 갱신
+    keys_.PushDownPath(parent_node);
+    static_cast<Node*>(parent_node)->GetValue() = value;
+
+    for (NodeAVL<K>* node = parent_node; node != nullptr; node = node->GetParent())
+    {
+        Traits::Update(node);
+    }
+
+    return false;
+}
+
+// [lo, hi]의 모든 value에 delta를 더함
+template <typename K, typename V, typename BalancePolicy>
+void MapRangeSumAVL<K, V, BalancePolicy>::AddRange(const K& lo, const K& hi, const V& delta)
+{
+    V pending = V();
+    NodeAVL<K>* split_node = FindSplitNode(lo, hi, pending);
+
+    if (split_node == nullptr)
+    {
+        return;
+    }
+
+    // node의 value_와 tag_는 조상의 tag와 무관하게 더할 수 있으므로 내려가면서 tag를 내려보내지 않음
+    static_cast<Node*>(split_node)->GetValue() += delta;
+
+    // left subtree에서 lo 이상인 node는 자신과 right subtree 전체가 범위 안에 있음
+    NodeAVL<K>* last_node = split_node;
+
+    for (NodeAVL<K>* node = split_node->GetLeft(); node != nullptr;)
+    {
+        last_node = node;
+
+        if (node->GetKey() < lo)
+        {
+            node = node->GetRight();
+            continue;
+        }
+
+        static_cast<Node*>(node)->GetValue() += delta;
+        Traits::AddToSubtree(node->GetRight(), delta);
+        node = node->GetLeft();
+    }
+
+    // 지나온 경로의 합을 아래에서부터 갱신
+    for (NodeAVL<K>* node = last_node; node != split_node; node = node->GetParent())
+    {
+        Traits::Update(node);
+    }
+
+    // right subtree에서 hi 이하인 node도 같은 방법으로 처리
+    last_node = split_node;
+
+    for (NodeAVL<K>* node = split_node->GetRight(); node != nullptr;)
+    {
+        last_node = node;
+
+        if (hi < node->GetKey())
+        {
+            node = node->GetLeft();
+            continue;
+        }
+
+        static_cast<Node*>(node)->GetValue() += delta;
+        Traits::AddToSubtree(node->GetLeft(), delta);
+        node = node->GetRight();
+    }
+
+    for (NodeAVL<K>* node = last_node; node != split_node; node = node->GetParent())
+    {
+        Traits::Update(node);
+    }
+
+    for (NodeAVL<K>* node = split_node; node != nullptr; node = node->GetParent())
+    {
+        Traits::Update(node);
+    }
+}
+
+// [lo, hi]의 value의 합
+template <typename K, typename V, typename BalancePolicy>
+V MapRangeSumAVL<K, V, BalancePolicy>::SumRange(const K& lo, const K& hi) const
+{
+    V pending = V();
+    NodeAVL<K>* split_node = FindSplitNode(lo, hi, pending);
+
+    if (split_node == nullptr)
+    {
+        return V();
+    }
+
+    // 이제부터 pending은 지나온 node를 포함한 조상의 tag의 합
+    pending += AsNode(split_node)->GetTag();
+    V sum = AsNode(split_node)->GetValue() + pending;
+
+    // 범위 안에 통째로 들어있는 subtree는 저장된 합에 조상의 tag * size를 더함
+    V lower_pending = pending;
+
+    for (const NodeAVL<K>* node = split_node->GetLeft(); node != nullptr;)
+    {
+        lower_pending += AsNode(node)->GetTag();
+
+        if (node->GetKey() < lo)
+        {
+            node = node->GetRight();
+            continue;
+        }
+
+        const NodeAVL<K>* right_node = node->GetRight();
+        sum += AsNode(node)->GetValue() + lower_pending;
+
+        if (right_node != nullptr)
+        {
+            sum += Traits::GetSum(right_node) + lower_pending * right_node->GetSize();
+        }
+
+        node = node->GetLeft();
+    }
+
+    V upper_pending = pending;
+
+    for (const NodeAVL<K>* node = split_node->GetRight(); node != nullptr;)
+    {
+        upper_pending += AsNode(node)->GetTag();
+
+        if (hi < node->GetKey())
+        {
+            node = node->GetLeft();
+            continue;
+        }
+
+        const NodeAVL<K>* left_node = node->GetLeft();
+        sum += AsNode(node)->GetValue() + upper_pending;
+
+        if (left_node != nullptr)
+        {
+            sum += Traits::GetSum(left_node) + upper_pending * left_node->GetSize();
+        }
+
+        node = node->GetRight();
+    }
+
+    return sum;
+}
+
+// lo와 hi 사이로 처음 들어오는 node를 찾음
+template <typename K, typename V, typename BalancePolicy>
+NodeAVL<K>* MapRangeSumAVL<K, V, BalancePolicy>::FindSplitNode(const K& lo, const K& hi, V& out_pending) const
+{
+    NodeAVL<K>* node = keys_.root_;
+
+    while (node != nullptr && (node->GetKey() < lo || hi < node->GetKey()))
+    {
+        out_pending += AsNode(node)->GetTag();
+        node = (node->GetKey() < lo) ? node->GetRight() : node->GetLeft();
+    }
+
+    return node;
+}
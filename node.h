@@ -18,7 +18,7 @@ class Node
 {
 public:
     virtual ~Node() {}
-    virtual int GetKey() const = 0;
+    virtual const T& GetKey() const = 0;
 };
 
 #endif
\ No newline at end of file
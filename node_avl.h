@@ -34,7 +34,7 @@ public:
     void SetSize(const int size) { size_ = size; }
     void SetLeft(NodeAVL<T>* left) { left_ = left; }
     void SetRight(NodeAVL<T>* right) { right_ = right; }
-    T GetKey() const override final { return key_; }
+    const T& GetKey() const override final { return key_; }
     int GetHeight() const { return height_; }
     int GetSize() const { return size_; }
     NodeAVL<T>* GetParent() const { return parent_; }
@@ -0,0 +1,139 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef NODE_BTREE_H
+#define NODE_BTREE_H
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+template <typename T>
+class SetBTree;
+
+// node의 key 배열에서 key보다 작은 key의 개수를 셈
+// 정수 key는 사용하지 않는 칸을 최댓값으로 채워두고 배열 전체를 분기 없이 비교하므로
+// 반복 횟수가 고정되어 compiler가 SIMD 비교로 vectorize할 수 있음
+// 그 외의 key는 사용하는 칸에서 이분 탐색
+template <typename T, int Capacity, bool IsIntegral = std::is_integral<T>::value>
+struct KeySearchBTree
+{
+    static int CountLessThan(const T* keys, int count, const T& key)
+    {
+        return static_cast<int>(std::lower_bound(keys, keys + count, key) - keys);
+    }
+
+    static void FillPadding(T*, int) {}
+};
+
+template <typename T, int Capacity>
+struct KeySearchBTree<T, Capacity, true>
+{
+    static int CountLessThan(const T* keys, int, const T& key)
+    {
+        int count = 0;
+
+        for (int i = 0; i < Capacity; i++)
+        {
+            count += (keys[i] < key) ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    // count번째 칸부터 최댓값으로 채움 (최댓값은 어떤 key보다도 작지 않으므로 개수에 포함되지 않음)
+    static void FillPadding(T* keys, int count)
+    {
+        std::fill(keys + count, keys + Capacity, std::numeric_limits<T>::max());
+    }
+};
+
+// SetBTree의 node 공통 부분
+// leaf인지 여부와 key의 개수만 가지고 있으며 실제 node는 LeafNodeBTree, InternalNodeBTree
+template <typename T>
+class NodeBTree
+{
+public:
+    // capacity를 16byte(SIMD register 하나)에 들어가는 key 개수의 배수로 내림
+    // 반복 횟수가 vector 길이의 배수이면 compiler가 나머지 처리 없이 vectorize함
+    static constexpr int RoundCapacity(int capacity)
+    {
+        return std::max<int>(4, capacity - capacity % std::max<int>(1, 16 / sizeof(T)));
+    }
+
+    bool IsLeaf() const { return is_leaf_; }
+    int GetCount() const { return count_; }
+protected:
+    friend class SetBTree<T>;
+
+    explicit NodeBTree(bool is_leaf) : is_leaf_(is_leaf), count_(0) {}
+
+    // leaf이면 true
+    bool is_leaf_;
+
+    // leaf는 key의 개수, internal node는 separator의 개수 (child의 개수 - 1)
+    int count_;
+};
+
+// key를 저장하는 leaf node (약 256byte, cache line 4개)
+// 이웃 leaf와 연결되어 있으므로 범위 탐색에서 tree를 다시 내려갈 필요가 없음
+template <typename T>
+class alignas(64) LeafNodeBTree : public NodeBTree<T>
+{
+public:
+    // leaf에 저장할 수 있는 key의 최대 개수
+    static constexpr int kCapacity = NodeBTree<T>::RoundCapacity(
+        static_cast<int>((256 - 16 - 2 * sizeof(void*)) / sizeof(T)) - 1);
+private:
+    friend class SetBTree<T>;
+    typedef KeySearchBTree<T, kCapacity> KeySearch;
+
+    LeafNodeBTree() : NodeBTree<T>(true), prev_(nullptr), next_(nullptr)
+    {
+        KeySearch::FillPadding(keys_, 0);
+    }
+
+    // 오름차순으로 저장한 key (분할 직전에만 kCapacity + 1개가 들어있음)
+    T keys_[kCapacity + 1];
+
+    // 앞, 뒤 leaf
+    LeafNodeBTree* prev_;
+    LeafNodeBTree* next_;
+};
+
+// child를 가리키는 internal node (약 512byte, cache line 8개)
+// i번째 child의 key는 (keys_[i - 1], keys_[i]] 범위에 있음
+// child별 원소의 개수를 저장하므로 Rank를 O(log n)에 계산할 수 있음
+template <typename T>
+class alignas(64) InternalNodeBTree : public NodeBTree<T>
+{
+public:
+    // internal node에 저장할 수 있는 separator의 최대 개수
+    static constexpr int kCapacity = NodeBTree<T>::RoundCapacity(
+        static_cast<int>((512 - 16) / (sizeof(T) + sizeof(void*) + sizeof(int))) - 2);
+private:
+    friend class SetBTree<T>;
+    typedef KeySearchBTree<T, kCapacity> KeySearch;
+
+    InternalNodeBTree() : NodeBTree<T>(false)
+    {
+        KeySearch::FillPadding(keys_, 0);
+    }
+
+    // i번째 child의 최댓값 이상인 separator (분할 직전에만 kCapacity + 1개가 들어있음)
+    T keys_[kCapacity + 1];
+
+    // child와 child를 root로 하는 subtree의 원소 개수
+    NodeBTree<T>* children_[kCapacity + 2];
+    int child_sizes_[kCapacity + 2];
+};
+
+#endif
@@ -0,0 +1,63 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef NODE_HANDLE_AVL_H
+#define NODE_HANDLE_AVL_H
+
+#include "node_avl.h"
+#include "set_avl_augmentation.h"
+
+template <typename T, typename BalancePolicy, typename Augmentation>
+class SetAVL;
+
+// SetAVL::Extract로 꺼낸 node를 소유하는 handle (std::set의 node handle과 같은 역할)
+// SetAVL::Insert(handle)로 다시 삽입하면 메모리 할당이나 key 복사 없이 node가 그대로 연결됨
+// 삽입되지 않은 채로 handle이 소멸되면 node의 메모리를 해제함
+// node의 type은 Augmentation에 따라 다르므로 같은 Augmentation을 가진 SetAVL에만 삽입할 수 있음
+template <typename T, typename Augmentation = SetAVLNoAugmentation>
+class NodeHandleAVL
+{
+public:
+    NodeHandleAVL() : node_(nullptr) {}
+    NodeHandleAVL(NodeHandleAVL&& other) noexcept : node_(other.node_) { other.node_ = nullptr; }
+    ~NodeHandleAVL() { delete node_; }
+
+    NodeHandleAVL& operator=(NodeHandleAVL&& other) noexcept
+    {
+        if (this != &other)
+        {
+            delete node_;
+            node_ = other.node_;
+            other.node_ = nullptr;
+        }
+
+        return *this;
+    }
+
+    // handle이 node를 가지고 있지 않으면 true
+    bool IsEmpty() const { return node_ == nullptr; }
+
+    // node의 key를 return (IsEmpty()가 false인 경우에만 호출)
+    T GetKey() const { return node_->GetKey(); }
+private:
+    template <typename U, typename BalancePolicy, typename A>
+    friend class SetAVL;
+
+    // 복사 생성자, 대입 연산자 사용 방지
+    DISALLOW_COPY_AND_ASSIGN(NodeHandleAVL);
+
+    explicit NodeHandleAVL(NodeAVL<T>* node) : node_(node) {}
+
+    // handle이 소유하고 있는 node (어떤 Set에도 연결되어 있지 않음)
+    NodeAVL<T>* node_;
+};
+
+#endif
@@ -0,0 +1,83 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef NODE_HASH_INDEX_H
+#define NODE_HASH_INDEX_H
+
+#include "node_avl.h"
+#include "set_hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// SetAVL의 key로 node를 찾는 hash index (open addressing, linear probing)
+// node는 rotation을 해도 메모리 위치가 바뀌지 않으므로 Insert한 pointer는 Erase할 때까지 유효함
+// slot에 key의 hash를 함께 저장하므로 hash가 다른 slot은 node를 읽지 않고 건너뜀
+// 삭제는 tombstone을 남기지 않고 뒤의 slot을 당겨오므로(backward shift) 삭제가 많아도 느려지지 않음
+// slot의 개수는 2의 거듭제곱이며 node가 slot의 3/4를 넘으면 2배로 늘림
+template <typename T>
+class NodeHashIndex
+{
+public:
+    NodeHashIndex() : size_(0), mask_(0) {}
+
+    // 비우고 node를 expected_count개까지 slot을 늘리지 않고 담을 수 있도록 할당
+    void Reset(int expected_count);
+
+    // node를 index에 추가 (같은 key를 가진 node가 없어야 함)
+    void Insert(NodeAVL<T>* node);
+
+    // index에 들어있는 node를 제거
+    void Erase(const NodeAVL<T>* node);
+
+    // index에 들어있는 node를 같은 key를 가진 new_node로 바꿈 (node를 다른 위치로 옮긴 경우)
+    void Replace(const NodeAVL<T>* node, NodeAVL<T>* new_node);
+
+    // key를 가진 node를 return (없으면 nullptr)
+    NodeAVL<T>* Find(const T& key) const;
+
+    // index에 들어있는 node의 개수
+    int GetSize() const { return size_; }
+
+    // slot 배열이 사용하는 byte 수
+    std::size_t GetMemoryBytes() const { return sizeof(*this) + slots_.capacity() * sizeof(Slot); }
+private:
+    // 처음 할당하는 slot의 개수
+    static constexpr std::size_t kMinSlotCount = 16;
+
+    struct Slot
+    {
+        // node의 key의 SetHashKey
+        std::uint64_t hash;
+
+        // 빈 slot이면 nullptr
+        NodeAVL<T>* node;
+    };
+
+    // node를 가리키는 slot의 위치 (index에 들어있는 node에 대해서만 호출)
+    std::size_t FindSlot(const NodeAVL<T>* node) const;
+
+    // slot의 개수를 2배로 늘리고 모든 node를 다시 배치
+    void Grow();
+
+    std::vector<Slot> slots_;
+
+    // index에 들어있는 node의 개수
+    int size_;
+
+    // slot의 개수 - 1 (hash & mask_가 slot의 위치)
+    std::size_t mask_;
+};
+
+#include "node_hash_index.hpp"
+
+#endif
@@ -0,0 +1,152 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "node_hash_index.h"
+
+// 비우고 node를 expected_count개까지 slot을 늘리지 않고 담을 수 있도록 할당
+template <typename T>
+void NodeHashIndex<T>::Reset(int expected_count)
+{
+    std::size_t slot_count = kMinSlotCount;
+
+    while (slot_count / 4 * 3 < static_cast<std::size_t>(expected_count))
+    {
+        slot_count *= 2;
+    }
+
+    slots_.assign(slot_count, Slot{ 0, nullptr });
+    size_ = 0;
+    mask_ = slot_count - 1;
+}
+
+// node를 index에 추가
+template <typename T>
+void NodeHashIndex<T>::Insert(NodeAVL<T>* node)
+{
+    if (static_cast<std::size_t>(size_ + 1) > slots_.size() / 4 * 3)
+    {
+        Grow();
+    }
+
+    const std::uint64_t hash = SetHashKey(node->GetKey());
+    std::size_t index = hash & mask_;
+
+    while (slots_[index].node != nullptr)
+    {
+        index = (index + 1) & mask_;
+    }
+
+    slots_[index] = Slot{ hash, node };
+    size_++;
+}
+
+// index에 들어있는 node를 제거
+// 뒤따르는 slot 중 원래 위치에서 빈 자리까지 탐색이 이어지는 slot을 앞으로 당겨서
+// 빈 자리 때문에 탐색이 끊기지 않게 함
+template <typename T>
+void NodeHashIndex<T>::Erase(const NodeAVL<T>* node)
+{
+    std::size_t empty_index = FindSlot(node);
+    std::size_t index = empty_index;
+
+    while (true)
+    {
+        index = (index + 1) & mask_;
+
+        if (slots_[index].node == nullptr)
+        {
+            break;
+        }
+
+        // slot의 원래 위치부터 index까지의 거리가 빈 자리까지의 거리 이상이면
+        // 빈 자리가 탐색 경로 위에 있으므로 당겨올 수 있음
+        const std::size_t home_index = slots_[index].hash & mask_;
+
+        if (((index - home_index) & mask_) >= ((index - empty_index) & mask_))
+        {
+            slots_[empty_index] = slots_[index];
+            empty_index = index;
+        }
+    }
+
+    slots_[empty_index] = Slot{ 0, nullptr };
+    size_--;
+}
+
+// index에 들어있는 node를 같은 key를 가진 new_node로 바꿈
+template <typename T>
+void NodeHashIndex<T>::Replace(const NodeAVL<T>* node, NodeAVL<T>* new_node)
+{
+    slots_[FindSlot(node)].node = new_node;
+}
+
+// key를 가진 node를 return (없으면 nullptr)
+template <typename T>
+NodeAVL<T>* NodeHashIndex<T>::Find(const T& key) const
+{
+    if (slots_.empty())
+    {
+        return nullptr;
+    }
+
+    const std::uint64_t hash = SetHashKey(key);
+
+    for (std::size_t index = hash & mask_; slots_[index].node != nullptr; index = (index + 1) & mask_)
+    {
+        if (slots_[index].hash == hash && slots_[index].node->GetKey() == key)
+        {
+            return slots_[index].node;
+        }
+    }
+
+    return nullptr;
+}
+
+// node를 가리키는 slot의 위치
+template <typename T>
+std::size_t NodeHashIndex<T>::FindSlot(const NodeAVL<T>* node) const
+{
+    std::size_t index = SetHashKey(node->GetKey()) & mask_;
+
+    while (slots_[index].node != node)
+    {
+        index = (index + 1) & mask_;
+    }
+
+    return index;
+}
+
+// slot의 개수를 2배로 늘리고 모든 node를 다시 배치
+template <typename T>
+void NodeHashIndex<T>::Grow()
+{
+    std::vector<Slot> old_slots;
+    old_slots.swap(slots_);
+
+    const std::size_t slot_count = old_slots.empty() ? kMinSlotCount : 2 * old_slots.size();
+    slots_.assign(slot_count, Slot{ 0, nullptr });
+    mask_ = slot_count - 1;
+
+    for (const Slot& slot : old_slots)
+    {
+        if (slot.node != nullptr)
+        {
+            std::size_t index = slot.hash & mask_;
+
+            while (slots_[index].node != nullptr)
+            {
+                index = (index + 1) & mask_;
+            }
+
+            slots_[index] = slot;
+        }
+    }
+}
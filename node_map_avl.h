@@ -0,0 +1,56 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef NODE_MAP_AVL_H
+#define NODE_MAP_AVL_H
+
+#include "node_avl.h"
+
+#include <utility>
+
+// MapAVL의 node (NodeAVL에 key와 연결된 value를 함께 저장)
+template <typename K, typename V>
+class MapNodeAVL : public NodeAVL<K>
+{
+public:
+    // value는 args로 node 안에서 바로 생성함
+    template <typename... Args>
+    MapNodeAVL(const K& key, Args&&... args) : NodeAVL<K>(key), value_(std::forward<Args>(args)...) {}
+    V& GetValue() { return value_; }
+    const V& GetValue() const { return value_; }
+private:
+    // key에 연결된 value
+    V value_;
+};
+
+// MapRangeSumAVL의 node (subtree의 value의 합과 subtree 전체에 더하기로 미뤄둔 값을 함께 저장)
+// node의 실제 value = value_ + 자신과 모든 조상의 tag_
+// sum_ = 두 child의 sum_ + value_ + tag_ * size (조상의 tag_는 포함하지 않음)
+template <typename K, typename V>
+class RangeSumMapNodeAVL : public MapNodeAVL<K, V>
+{
+public:
+    template <typename... Args>
+    RangeSumMapNodeAVL(const K& key, Args&&... args) :
+        MapNodeAVL<K, V>(key, std::forward<Args>(args)...), sum_(this->GetValue()), tag_() {}
+    void SetSum(const V& sum) { sum_ = sum; }
+    void SetTag(const V& tag) { tag_ = tag; }
+    const V& GetSum() const { return sum_; }
+    const V& GetTag() const { return tag_; }
+private:
+    // 해당 node를 루트 노드로 하는 subtree의 value의 합
+    V sum_;
+
+    // subtree의 모든 value에 더해야 하지만 아직 자식에게 내려보내지 않은 값
+    V tag_;
+};
+
+#endif
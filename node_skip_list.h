@@ -0,0 +1,59 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef NODE_SKIP_LIST_H
+#define NODE_SKIP_LIST_H
+
+#include <atomic>
+#include <cstdint>
+
+template <typename T>
+class SetSkipList;
+
+// SetSkipList의 node (높이 height_의 tower)
+// 각 level의 다음 node pointer의 최하위 bit는 이 node가 해당 level에서
+// 논리적으로 삭제되었다는 표시로 사용함 (표시된 pointer는 CAS로 바꿀 수 없음)
+template <typename T>
+class NodeSkipList
+{
+public:
+    NodeSkipList(const T& key, int height)
+        : key_(key), height_(height), next_(new std::atomic<std::uintptr_t>[height]),
+        release_count_(0)
+    {
+        for (int i = 0; i < height; i++)
+        {
+            next_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ~NodeSkipList() { delete[] next_; }
+
+    const T& GetKey() const { return key_; }
+    int GetHeight() const { return height_; }
+private:
+    friend class SetSkipList<T>;
+
+    NodeSkipList(const NodeSkipList&) = delete;
+    NodeSkipList& operator=(const NodeSkipList&) = delete;
+
+    T key_;
+    int height_;
+
+    // level별 다음 node (삭제 표시 bit 포함)
+    std::atomic<std::uintptr_t>* next_;
+
+    // 삽입한 thread와 삭제한 thread가 각자 작업을 마치면 1씩 증가
+    // 2가 되게 만든 thread가 node를 모든 level에서 떼어낸 뒤 회수기에 넘김
+    std::atomic<int> release_count_;
+};
+
+#endif
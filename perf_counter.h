@@ -0,0 +1,298 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef PERF_COUNTER_H
+#define PERF_COUNTER_H
+
+#include <cstdint>
+#include <iomanip>
+#include <ios>
+#include <ostream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// 측정할 하드웨어 성능 카운터의 종류
+enum class PerfEvent
+{
+    kCycles,
+    kInstructions,
+    kL1DataMisses,
+    kLastLevelCacheMisses,
+    kBranchMisses,
+    kDataTLBMisses,
+    kCount
+};
+
+// Linux perf_event_open을 이용한 하드웨어 성능 카운터
+// 컨테이너 등에서 카운터를 열 수 없는 경우 해당 카운터는 사용 불가로 표시되고
+// 측정은 계속 진행됨 (값은 -1)
+class PerfCounter
+{
+public:
+    PerfCounter();
+    ~PerfCounter();
+
+    // 하나 이상의 카운터를 사용할 수 있으면 true
+    bool IsAvailable() const;
+
+    // 해당 카운터를 사용할 수 있으면 true
+    bool IsAvailable(PerfEvent event) const
+    {
+        return file_descriptors_[static_cast<int>(event)] != -1;
+    }
+
+    // 카운터를 0으로 초기화하고 측정 시작
+    void Start();
+
+    // 측정을 멈추고 값을 읽어옴
+    void Stop();
+
+    // 마지막 측정 구간의 값을 return (사용할 수 없는 카운터는 -1)
+    long long GetValue(PerfEvent event) const
+    {
+        return values_[static_cast<int>(event)];
+    }
+
+    // 카운터의 이름을 return
+    static const char* GetEventName(PerfEvent event);
+
+    // 마지막 측정 구간의 카운터 값을 연산 1회당 값으로 출력
+    void PrintPerOperation(std::ostream& output_stream, long long operations) const;
+private:
+    // 복사 생성자, 대입 연산자 사용 방지
+    PerfCounter(const PerfCounter&);
+    void operator=(const PerfCounter&);
+
+    static constexpr int kEventCount = static_cast<int>(PerfEvent::kCount);
+
+    // 카운터별 file descriptor (열지 못한 경우 -1)
+    int file_descriptors_[kEventCount];
+
+    // 카운터별 마지막 측정값
+    long long values_[kEventCount];
+};
+
+#if defined(__linux__)
+namespace perf_counter_internal
+{
+// PerfEvent에 대응하는 perf_event_attr의 type, config
+inline void GetEventConfig(PerfEvent event, __u32& type, __u64& config)
+{
+    const __u64 read_miss =
+        PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+
+    switch (event)
+    {
+    case PerfEvent::kCycles:
+        type = PERF_TYPE_HARDWARE;
+        config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case PerfEvent::kInstructions:
+        type = PERF_TYPE_HARDWARE;
+        config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+    case PerfEvent::kL1DataMisses:
+        type = PERF_TYPE_HW_CACHE;
+        config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+        break;
+    case PerfEvent::kLastLevelCacheMisses:
+        type = PERF_TYPE_HARDWARE;
+        config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+    case PerfEvent::kBranchMisses:
+        type = PERF_TYPE_HARDWARE;
+        config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    default:
+        type = PERF_TYPE_HW_CACHE;
+        config = PERF_COUNT_HW_CACHE_DTLB | read_miss;
+        break;
+    }
+}
+}
+#endif
+
+inline PerfCounter::PerfCounter()
+{
+    for (int i = 0; i < kEventCount; i++)
+    {
+        file_descriptors_[i] = -1;
+        values_[i] = -1;
+
+#if defined(__linux__)
+        perf_event_attr attribute = {};
+        attribute.size = sizeof(attribute);
+        attribute.disabled = 1;
+        attribute.exclude_kernel = 1;
+        attribute.exclude_hv = 1;
+        // multiplexing이 일어난 경우 값을 보정하기 위해 실행 시간도 함께 읽음
+        attribute.read_format =
+            PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        perf_counter_internal::GetEventConfig(
+            static_cast<PerfEvent>(i), attribute.type, attribute.config);
+
+        // 현재 thread, 모든 CPU에 대해 측정
+        long file_descriptor = syscall(SYS_perf_event_open, &attribute, 0, -1, -1, 0);
+
+        if (file_descriptor >= 0)
+        {
+            file_descriptors_[i] = static_cast<int>(file_descriptor);
+        }
+#endif
+    }
+}
+
+inline PerfCounter::~PerfCounter()
+{
+#if defined(__linux__)
+    for (int i = 0; i < kEventCount; i++)
+    {
+        if (file_descriptors_[i] != -1)
+        {
+            close(file_descriptors_[i]);
+        }
+    }
+#endif
+}
+
+inline bool PerfCounter::IsAvailable() const
+{
+    for (int i = 0; i < kEventCount; i++)
+    {
+        if (file_descriptors_[i] != -1)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline void PerfCounter::Start()
+{
+#if defined(__linux__)
+    for (int i = 0; i < kEventCount; i++)
+    {
+        if (file_descriptors_[i] != -1)
+        {
+            ioctl(file_descriptors_[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(file_descriptors_[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+inline void PerfCounter::Stop()
+{
+#if defined(__linux__)
+    for (int i = 0; i < kEventCount; i++)
+    {
+        if (file_descriptors_[i] != -1)
+        {
+            ioctl(file_descriptors_[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    for (int i = 0; i < kEventCount; i++)
+    {
+        values_[i] = -1;
+
+        if (file_descriptors_[i] == -1)
+        {
+            continue;
+        }
+
+        // value, time_enabled, time_running 순서
+        std::uint64_t buffer[3] = {};
+
+        if (read(file_descriptors_[i], buffer, sizeof(buffer)) != sizeof(buffer))
+        {
+            continue;
+        }
+
+        if (buffer[2] == 0)
+        {
+            // 측정 구간 동안 한 번도 스케줄 되지 못함
+            values_[i] = 0;
+        }
+        else if (buffer[2] < buffer[1])
+        {
+            // multiplexing에 의해 일부 구간만 측정된 경우 비율에 맞게 보정
+            values_[i] = static_cast<long long>(
+                static_cast<double>(buffer[0]) * buffer[1] / buffer[2]);
+        }
+        else
+        {
+            values_[i] = static_cast<long long>(buffer[0]);
+        }
+    }
+#endif
+}
+
+inline const char* PerfCounter::GetEventName(PerfEvent event)
+{
+    switch (event)
+    {
+    case PerfEvent::kCycles:
+        return "cycles";
+    case PerfEvent::kInstructions:
+        return "instructions";
+    case PerfEvent::kL1DataMisses:
+        return "L1d-misses";
+    case PerfEvent::kLastLevelCacheMisses:
+        return "LLC-misses";
+    case PerfEvent::kBranchMisses:
+        return "branch-misses";
+    case PerfEvent::kDataTLBMisses:
+        return "dTLB-misses";
+    default:
+        return "unknown";
+    }
+}
+
+inline void PerfCounter::PrintPerOperation(
+    std::ostream& output_stream, long long operations) const
+{
+    if (!IsAvailable())
+    {
+        output_stream << "  perf: unavailable";
+        return;
+    }
+
+    // 호출한 쪽의 출력 형식이 바뀌지 않도록 flag와 precision을 저장해두고 복원
+    const std::ios_base::fmtflags original_flags = output_stream.flags();
+    const std::streamsize original_precision = output_stream.precision();
+
+    for (int i = 0; i < kEventCount; i++)
+    {
+        output_stream << "  " << GetEventName(static_cast<PerfEvent>(i)) << "/op=";
+
+        if (values_[i] < 0 || operations <= 0)
+        {
+            output_stream << "n/a";
+        }
+        else
+        {
+            output_stream << std::fixed << std::setprecision(2)
+                << static_cast<double>(values_[i]) / operations;
+        }
+    }
+
+    output_stream.flags(original_flags);
+    output_stream.precision(original_precision);
+}
+
+#endif
@@ -12,14 +12,130 @@
 #ifndef SET_AVL_H
 #define SET_AVL_H
 
+#include "blocked_bloom_filter.h"
+#include "frozen_set_avl.h"
+#include "hot_key_cache.h"
 #include "node_avl.h"
+#include "node_handle_avl.h"
+#include "node_hash_index.h"
 #include "set.h"
+#include "set_avl_augmentation.h"
 
-template <typename T>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// SetAVL의 tree 모양과 메모리 사용량에 대한 통계
+struct SetAVLShapeReport
+{
+    // Set에 들어있는 원소의 개수
+    int size;
+
+    // root node의 height (Set이 비어있으면 -1)
+    int height;
+
+    // 같은 원소 개수로 만들 수 있는 가장 낮은 binary tree의 height (floor(log2(n)))
+    int optimal_height;
+
+    // height / log2(n + 1), 1에 가까울수록 이상적인 모양
+    double height_ratio;
+
+    // 모든 node의 depth의 평균과 최댓값
+    double average_depth;
+    int max_depth;
+
+    // balance factor가 +1, 0, -1인 node의 개수
+    int left_heavy_count;
+    int balanced_count;
+    int right_heavy_count;
+
+    // balance factor의 절댓값이 2 이상인 node의 개수 (정상적인 AVL Tree라면 0)
+    int unbalanced_count;
+
+    // root node의 size_와 Set의 size_가 일치하는지 여부
+    bool size_consistent;
+
+    // NodeAVL 하나의 크기 (sizeof)
+    std::size_t node_bytes;
+
+    // allocator가 실제로 node 하나에 사용하는 평균 byte 수 (chunk header 포함)
+    double allocated_bytes_per_node;
+
+    // Set 객체와 모든 node가 사용하는 byte 수의 합
+    std::size_t total_bytes;
+
+    // 원소 하나당 사용하는 byte 수
+    double bytes_per_element;
+};
+
+// 정렬된 query에 대한 batch 탐색 결과
+struct SetAVLQueryResult
+{
+    // key를 가지고 있는 node의 depth (없으면 -1)
+    int depth;
+
+    // Set에서 key보다 작은 원소의 개수 + 1 (없으면 0)
+    int rank;
+
+    // key가 Set에 들어있는지 여부
+    bool found;
+};
+
+// SetAVL::Compact에서 node를 연속된 메모리에 놓는 순서
+// kSetAVLCompactInOrder: 중위 순회 순서 (오름차순 순회와 범위 탐색이 메모리를 차례로 읽음)
+// kSetAVLCompactVanEmdeBoas: tree를 height의 절반씩 위, 아래 subtree로 재귀적으로 나눈 순서
+//     어떤 크기의 cache line에서도 root에서 내려가는 경로가 O(log_B n)개의 block에 놓임
+enum SetAVLCompactOrder
+{
+    kSetAVLCompactInOrder,
+    kSetAVLCompactVanEmdeBoas
+};
+
+// SetAVL의 rebalancing 방식 (node 구조는 같고 NodeAVL의 height_를 해석하는 방법만 다름)
+// AVLBalancePolicy: height_는 subtree의 height이고 모든 node의 balance factor를 -1, 0, 1로 유지
+//     삭제할 때 root까지 올라가며 level마다 rotation이 일어날 수 있음
+struct AVLBalancePolicy
+{
+    static constexpr bool kRankBalanced = false;
+};
+
+// WeakAVLBalancePolicy: height_는 rank이고 부모와 자식의 rank 차이를 1 또는 2로 유지
+// (leaf의 rank는 0, 없는 자식의 rank는 -1)
+//     삽입만 하는 경우 AVLBalancePolicy와 같은 모양의 tree를 만들고,
+//     삭제할 때 rotation은 최대 2번, rank 변경은 amortized O(1)
+//     tree의 height는 2 log2(n + 1) 이하
+struct WeakAVLBalancePolicy
+{
+    static constexpr bool kRankBalanced = true;
+};
+
+template <typename K, typename V, typename BalancePolicy>
+class MapAVL;
+
+template <typename K, typename V, typename BalancePolicy>
+class MapRangeSumAVL;
+
+// Augmentation: 각 node에 subtree의 aggregate를 저장하는 monoid (set_avl_augmentation.h 참고)
+//     SetAVLNoAugmentation이면 node는 NodeAVL 그대로이고 aggregate를 갱신하는 비용이 없음
+template <typename T, typename BalancePolicy = AVLBalancePolicy, typename Augmentation = SetAVLNoAugmentation>
 class SetAVL : public Set<T>
 {
 public:
-    SetAVL() : size_(0), root_(nullptr) {}
+    // Insert(hint, key)에 넘기는 삽입 위치 (Set에 들어있는 node)
+    // 해당 node가 Erase되면 더 이상 사용할 수 없음
+    typedef const NodeAVL<T>* Hint;
+
+    // Aggregate가 return하는 Augmentation::Value
+    typedef typename SetAVLAugmentationTraits<T, Augmentation>::Value AggregateValue;
+
+    SetAVL() :
+        size_(0), root_(nullptr), finger_(nullptr), leftmost_(nullptr), rightmost_(nullptr),
+        rotation_count_(0), relaxed_balance_(false), rebalance_budget_(0),
+        compacting_(false), compact_cursor_(), filter_enabled_(false), filter_bits_per_key_(0),
+        hash_index_enabled_(false), hot_key_cache_enabled_(false), structure_version_(0) {}
     SetAVL(const SetAVL& setavl);
     SetAVL& operator=(const SetAVL& setavl);
     ~SetAVL();
@@ -43,6 +159,19 @@ public:
     // key를 삽입하고 해당 node의 depth를 출력
     int Insert(const T key) override final;
 
+    // hint 근처에서 삽입할 위치를 찾아 key를 삽입하고 해당 node의 depth를 return
+    // hint에서 위로 올라가며 key가 들어갈 subtree를 찾은 뒤 내려가므로
+    // hint와 삽입 위치 사이의 거리가 d이면 탐색은 O(log d)
+    // (size와 depth를 위해 root까지 한 번 올라가는 것은 그대로 필요함)
+    int Insert(Hint hint, const T key);
+
+    // 마지막으로 삽입한 node를 hint로 사용하여 key를 삽입
+    // 정렬되었거나 거의 정렬된 key를 차례로 삽입할 때 사용
+    int InsertNearFinger(const T key);
+
+    // 마지막으로 삽입한 node의 위치를 return (없으면 nullptr)
+    Hint GetFinger() const;
+
     // Advanced 기능
     // 해당 key를 가지고 있는 node의 depth와 rank를 출력
     // rank: Set에서 해당 node보다 작은 key 값을 가진 node의 개수 + 1
@@ -50,13 +179,243 @@ public:
 
     // 해당 key를 가지고 있는 노드를 삭제하고 해당 노드의 depth를 return
     int Erase(const T key) override final;
+
+    // Set의 모든 원소를 삭제
+    void Clear();
+
+    // 오름차순으로 정렬되고 중복이 없는 [first, last)의 key로 Set의 내용을 교체
+    // 균형 잡힌 tree를 아래에서 위로 O(n)에 구성하므로 rebalancing이 없음
+    // 모든 node를 새로 만드므로 value를 저장하는 MapAVL, MapRangeSumAVL의 key set에서는 사용할 수 없음
+    template <typename Iterator>
+    void AssignSorted(Iterator first, Iterator last);
+
+    // Node handle 기능
+    // key를 가진 node를 Set에서 떼어내어 handle로 return (없으면 빈 handle)
+    // 다른 node는 메모리 위치가 바뀌지 않으므로 다른 node를 가리키는 Hint는 계속 유효함
+    NodeHandleAVL<T, Augmentation> Extract(const T key);
+
+    // handle이 가진 node를 메모리 할당 없이 Set에 연결하고 depth를 return
+    // 같은 key가 이미 있거나 handle이 비어있으면 -1을 return하고 handle은 변하지 않음
+    int Insert(NodeHandleAVL<T, Augmentation>& handle);
+
+    // other의 node 중 이 Set에 없는 key를 가진 node를 메모리 할당 없이 옮겨옴
+    // 같은 key가 이미 있는 node는 other에 남음
+    void Merge(SetAVL& other);
+
+    // 최솟값, 최댓값 기능
+    // 최솟값, 최댓값을 가진 node를 항상 저장해두므로 O(1)
+    // Set이 비어있으면 false를 return하고 out_key는 변하지 않음
+    bool GetMin(T& out_key) const;
+    bool GetMax(T& out_key) const;
+
+    // 최솟값, 최댓값을 out_key에 저장하고 삭제 (priority queue로 사용)
+    // 삭제되는 node는 자식이 최대 1개이고 rotation은 amortized O(1)이지만,
+    // 각 node의 size를 갱신하기 위해 root node까지 한 번 올라감
+    bool PopMin(T& out_key);
+    bool PopMax(T& out_key);
+
+    // keys의 각 key에 대한 Find 결과(depth, 없으면 -1)를 out_depths에 저장
+    // 여러 key의 탐색을 한 단계씩 번갈아 진행하면서 다음 node를 prefetch하여
+    // cache miss의 대기 시간이 서로 겹치도록 함
+    void FindBatch(const std::vector<T>& keys, std::vector<int>& out_depths) const;
+
+    // key가 Set에 들어있으면 true
+    bool Contains(const T key) const;
+
+    // 오름차순으로 정렬된 query 전체를 tree를 한 번 순회하면서 처리함
+    // 각 node에서 query 목록을 key보다 작은 부분과 큰 부분으로 나누어 자식에게 넘기므로
+    // query m개에 대해 O(m log(n / m + 1))의 node만 방문함
+    void QuerySorted(
+        const std::vector<T>& sorted_keys,
+        std::vector<SetAVLQueryResult>& out_results) const;
+
+    // QuerySorted의 결과 중 depth, rank, found만 각각 저장
+    void FindSorted(const std::vector<T>& sorted_keys, std::vector<int>& out_depths) const;
+    void RankSorted(const std::vector<T>& sorted_keys, std::vector<int>& out_ranks) const;
+    void ContainsSorted(const std::vector<T>& sorted_keys, std::vector<bool>& out_found) const;
+
+    // Relaxed balance 기능 (AVLBalancePolicy에서만 사용 가능)
+    // enabled이면 Insert, Erase는 rotation 없이 size, height만 갱신하고
+    // balance factor의 절댓값이 2 이상이 된 node를 기록만 함
+    // 기록된 node는 이후 Insert, Erase가 끝날 때마다 최대 budget_per_operation개씩,
+    // 또는 RebalancePending을 호출할 때 rebalancing함
+    // false로 바꾸면 기록된 node를 모두 rebalancing하여 AVL Tree로 되돌림
+    void SetRelaxedBalance(bool enabled, int budget_per_operation = 0);
+
+    // 기록된 node를 최대 budget개 rebalancing하고 남은 node의 개수를 return
+    // 남은 node가 없으면 모든 node의 balance factor가 -1, 0, 1이므로 AVL Tree의 height가 보장됨
+    // Set은 동기화를 하지 않으므로 다른 thread에서 호출하려면 다른 연산과 같은 lock 안에서 호출해야 함
+    int RebalancePending(int budget);
+
+    // rebalancing을 기다리는 node의 개수
+    int GetPendingCount() const { return static_cast<int>(pending_nodes_.size()); }
+
+    // Membership filter 기능
+    // enabled이면 Set의 key를 BlockedBloomFilter에도 담아두고, Find와 Contains는
+    // filter가 없다고 판단한 key에 대해 tree를 탐색하지 않고 바로 -1, false를 return
+    // (찾지 못하는 탐색이 대부분인 경우에 사용, 찾는 탐색은 filter를 한 번 더 읽는 만큼 느려짐)
+    // filter는 원소 개수의 2배를 담을 수 있게 만들고, 원소가 그보다 많아지거나
+    // 삭제된 key가 filter에 담긴 key의 절반을 넘으면 현재 원소로 O(n)에 다시 만듦
+    // bits_per_key: filter가 가득 찼을 때 key 하나당 bit 수 (10이면 false positive 비율은 약 1%)
+    void SetMembershipFilter(bool enabled, int bits_per_key = 10);
+
+    // 사용 중인 filter (사용하지 않으면 nullptr)
+    const BlockedBloomFilter<T>* GetMembershipFilter() const { return filter_enabled_ ? &filter_ : nullptr; }
+
+    // Hash index 기능
+    // enabled이면 key에서 node로의 hash index(NodeHashIndex)를 Insert, Erase와 함께 유지하여
+    // Contains는 O(1)에, Find는 찾은 node에서 root까지 parent를 따라 올라가며 O(depth)에 처리함
+    // (tree를 내려가면서 key를 비교하지 않으므로 찾는 key가 있는 경우에도 빨라짐)
+    // node 하나당 slot 1.33 ~ 2.67개(slot 하나는 16byte)를 더 사용함
+    void SetHashIndex(bool enabled);
+
+    // 사용 중인 hash index (사용하지 않으면 nullptr)
+    const NodeHashIndex<T>* GetHashIndex() const { return hash_index_enabled_ ? &hash_index_ : nullptr; }
+
+    // Hot key cache 기능
+    // enabled이면 Find, Rank로 찾은 key의 (node, depth, rank)를 slot_count개의 HotKeyCache에 저장하고
+    // 같은 key를 다시 찾으면 root부터 tree를 내려가지 않고 저장한 결과를 사용함 (자주 찾는 key가 몰린 경우에 사용)
+    // Insert, Erase로 tree 모양이 바뀔 때마다 version이 올라가서 저장한 depth, rank가 모두 무효화되지만,
+    // node는 삭제될 때까지 그대로이므로 node에서 root까지 parent를 따라 올라가며 O(depth)에 다시 계산함
+    // cache를 사용하는 동안 Rank는 tree를 순회하지 않고 subtree의 size로 rank를 계산함
+    // slot 하나는 key와 40byte 정도이므로 기본값 1024개는 L2 cache에 들어감
+    void SetHotKeyCache(bool enabled, int slot_count = 1024);
+
+    // cache의 hit, stale hit, miss 횟수 (SetHotKeyCache를 호출하면 0부터 다시 셈)
+    HotKeyCacheStats GetHotKeyCacheStats() const { return hot_key_cache_.GetStats(); }
+    void ResetHotKeyCacheStats() { hot_key_cache_.ResetStats(); }
+
+    // Augmentation 기능 (Augmentation이 SetAVLNoAugmentation이 아닌 경우에만 사용 가능)
+    // [lo, hi]에 들어있는 key를 오름차순으로 Augmentation::Combine한 값을 O(log n)에 return
+    // lo와 hi의 경계를 따라 내려가면서 경계 안쪽 subtree의 aggregate를 통째로 합침 (빈 범위이면 Identity)
+    AggregateValue Aggregate(const T& lo, const T& hi) const;
+
+    // 분석 기능
+    // 생성된 이후 수행한 rotation의 횟수 (double rotation은 2번으로 셈)
+    long long GetRotationCount() const { return rotation_count_; }
+
+    // tree의 height, depth 분포, balance factor 분포와 메모리 사용량을 O(n)에 수집
+    // 재귀나 추가 메모리 할당 없이 parent pointer를 이용하여 한 번만 순회함
+    // WeakAVLBalancePolicy는 height_가 rank이므로 height와 balance factor를 후위 순회로 한 번 더 계산함
+    SetAVLShapeReport ShapeReport() const;
+
+    // Compaction 기능
+    // 모든 node를 새로 할당한 하나의 연속된 메모리 영역에 order 순서로 옮기고
+    // parent, left, right link를 바꿈 (tree의 모양과 key, depth는 바뀌지 않음)
+    // 삽입과 삭제를 반복하여 node가 heap 곳곳에 흩어진 Set의 탐색과 순회를 빠르게 함
+    // node의 메모리 위치가 바뀌므로 이전에 얻은 Hint는 더 이상 사용할 수 없음
+    void Compact(SetAVLCompactOrder order = kSetAVLCompactInOrder);
+
+    // Compact(kSetAVLCompactInOrder)를 여러 번에 나누어 진행함
+    // 처음 호출할 때 현재 원소의 개수만큼의 영역을 할당하고, 호출할 때마다 time_budget 동안
+    // 이전 호출이 멈춘 key부터 중위 순회 순서로 node를 영역에 옮김 (node 하나를 옮기는 것은 O(1))
+    // 호출 사이에 Insert, Erase를 해도 되며, 멈춘 key보다 작은 key로 새로 삽입된 node는 옮기지 않음
+    // 모든 node를 옮겼거나 영역이 가득 차서 끝났으면 true를 return
+    // 옮긴 node를 가리키는 Hint는 더 이상 사용할 수 없음
+    bool CompactIncrementally(std::chrono::microseconds time_budget);
+
+    // Compact, CompactIncrementally로 할당하여 아직 해제되지 않은 영역의 개수
+    int GetRegionCount() const { return static_cast<int>(regions_.size()); }
+
+    // Freeze 기능
+    // 현재 원소로 pointer가 없는 읽기 전용 Set을 O(n)에 만듦 (이후 이 Set을 바꿔도 영향 없음)
+    // 만든 뒤 바뀌지 않고 탐색만 반복하는 Set에 사용
+    FrozenSetAVL<T> Freeze() const;
+
+    // Snapshot 기능
+    // 모든 key를 오름차순으로 checksum이 포함된 binary 파일에 기록 (성공하면 true)
+    bool SaveSnapshot(const std::string& path) const;
+
+    // snapshot 파일로 Set의 내용을 교체 (실패하면 Set은 변하지 않고 false)
+    // 정렬된 key로부터 균형 잡힌 tree를 아래에서 위로 O(n)에 구성하므로 rebalancing이 없음
+    // AssignSorted와 같이 value를 저장하는 Map의 key set에서는 사용할 수 없음
+    bool LoadSnapshot(const std::string& path);
 private:
+    // MapAVL은 탐색 한 번으로 value가 들어있는 node를 찾고 삽입하기 위해 tree를 직접 사용함
+    template <typename K, typename V, typename P>
+    friend class MapAVL;
+
+    // MapRangeSumAVL은 범위의 경계를 따라 내려간 node의 aggregate를 직접 갱신함
+    template <typename K, typename V, typename P>
+    friend class MapRangeSumAVL;
+
+    typedef SetAVLAugmentationTraits<T, Augmentation> AugmentationTraits;
+
+    // Set이 할당하는 node의 type (Augmentation이 있으면 aggregate를 가진 AugmentedNodeAVL)
+    typedef typename AugmentationTraits::Node NodeType;
+
     // Set에 들어있는 원소의 개수
     int size_;
 
     // Set의 root node
     NodeAVL<T>* root_;
 
+    // 마지막으로 삽입한 node (InsertNearFinger에서 사용, 삭제되면 nullptr)
+    NodeAVL<T>* finger_;
+
+    // key가 최소, 최대인 node (Set이 비어있으면 nullptr)
+    NodeAVL<T>* leftmost_;
+    NodeAVL<T>* rightmost_;
+
+    // 생성된 이후 수행한 rotation의 횟수
+    long long rotation_count_;
+
+    // relaxed balance를 사용하는지 여부와 Insert, Erase마다 rebalancing할 node의 최대 개수
+    bool relaxed_balance_;
+    int rebalance_budget_;
+
+    // balance factor의 절댓값이 2 이상이지만 아직 rebalancing하지 않은 node
+    std::unordered_set<NodeAVL<T>*> pending_nodes_;
+
+    // Compact로 할당한 연속된 메모리 영역
+    // 영역에 있는 node는 delete 대신 FreeNode로 소멸시키고, 살아있는 node가 없어지면 영역을 해제함
+    struct NodeRegion
+    {
+        NodeType* nodes;
+
+        // 영역에 들어갈 수 있는 node의 개수와 지금까지 채운 node의 개수
+        int capacity;
+        int used;
+
+        // 영역에 있는 node 중 Set에 남아있는 node의 개수
+        int live_count;
+    };
+
+    // node가 들어있는 영역 (CompactIncrementally가 진행 중이면 마지막 영역에 node를 옮기는 중)
+    std::vector<NodeRegion> regions_;
+
+    // CompactIncrementally가 진행 중인지 여부와 다음 호출에서 옮기기 시작할 key
+    bool compacting_;
+    T compact_cursor_;
+
+    // CompactIncrementally에서 시간을 확인하는 간격 (옮기거나 지나간 node의 개수)
+    static constexpr int kCompactClockInterval = 64;
+
+    // membership filter를 사용하는지 여부와 filter가 가득 찼을 때 key 하나당 bit 수
+    bool filter_enabled_;
+    int filter_bits_per_key_;
+
+    // Set의 key를 담은 filter (filter_enabled_가 false이면 사용하지 않음)
+    BlockedBloomFilter<T> filter_;
+
+    // filter를 다시 만들 때 최소한으로 담을 수 있게 하는 key의 개수
+    static constexpr int kMinFilterCapacity = 64;
+
+    // hash index를 사용하는지 여부와 Set의 모든 node를 담은 hash index
+    bool hash_index_enabled_;
+    NodeHashIndex<T> hash_index_;
+
+    // hot key cache를 사용하는지 여부와 최근에 찾은 key의 결과를 저장한 cache
+    bool hot_key_cache_enabled_;
+    HotKeyCache<T> hot_key_cache_;
+
+    // node가 연결되거나 떼어지거나 rotation이 일어날 때마다 1씩 증가
+    // (hot_key_cache_에 저장한 depth, rank가 아직 맞는지 확인하는 데 사용)
+    std::uint64_t structure_version_;
+
+    // FindBatch에서 동시에 진행하는 탐색의 개수
+    static constexpr int kFindBatchWidth = 16;
+
     // Set을 Deep Copy함
     void DeepCopyForSetAVL(
         NodeAVL<T>* original_parent_node,
@@ -65,20 +424,57 @@ private:
     // 후위순회를 통해 SetAVL에 있는 노드의 메모리를 해제시킴
     void FreeMemoryForSetAVL(NodeAVL<T>* parent_node);
 
+    // node를 root로 하는 subtree에서 key가 최소인 node를 return
+    NodeAVL<T>* GetLeftmostNode(NodeAVL<T>* node) const;
+
+    // node를 root로 하는 subtree에서 key가 최대인 node를 return
+    NodeAVL<T>* GetRightmostNode(NodeAVL<T>* node) const;
+
+    // 중위 순회에서 node의 다음 node를 return (없으면 nullptr)
+    NodeAVL<T>* GetNextNodeInOrder(NodeAVL<T>* node) const;
+
+    // 중위 순회에서 node의 이전 node를 return (없으면 nullptr)
+    NodeAVL<T>* GetPreviousNodeInOrder(NodeAVL<T>* node) const;
+
+    // next_node()가 key의 오름차순으로 돌려주는 count개의 node로 균형 잡힌 subtree를 만들어 out_root에 저장
+    // 각 node의 left subtree는 count / 2개의 node를 가짐
+    // next_node()가 nullptr를 돌려주면 그때까지 만든 node를 해제하고 바로 false를 return
+    template <typename NodeSource>
+    bool BuildBalancedSubtree(int count, NodeSource& next_node, NodeAVL<T>*& out_root);
+
+    // 기존 tree를 해제하고 new_root를 root로 하는 count개의 node로 Set을 교체
+    void ReplaceRoot(NodeAVL<T>* new_root, int count);
+
+    // start_node를 root로 하는 subtree에서 key를 가진 node를 삽입할 위치를 찾음
+    // (Set이 비어있지 않은 경우에만 호출, key가 이미 있으면 false이고 out_parent_node는 그 node)
+    bool FindInsertPosition(
+        NodeAVL<T>* start_node, const T key,
+        NodeAVL<T>*& out_parent_node, bool& out_is_left_child) const;
+
+    // finger_node 근처에서 key를 가진 node를 삽입할 위치를 찾음
+    bool FindInsertPositionNearNode(
+        NodeAVL<T>* finger_node, const T key,
+        NodeAVL<T>*& out_parent_node, bool& out_is_left_child) const;
+
+    // parent_node의 비어있는 child 자리에 node를 leaf로 연결하고 depth를 return
+    // parent_node가 nullptr이면 빈 Set의 root node로 연결
+    int LinkNode(NodeAVL<T>* parent_node, bool is_left_child, NodeAVL<T>* node);
+
     // 해당 node의 height를 재설정
     void UpdateHeight(NodeAVL<T>* node);
 
-    // start_node부터 root node까지 모든 node의 height 갱신
-    void UpdateHeightUntilRoot(NodeAVL<T>* start_node);
-
     // 해당 node의 size를 재설정
     void UpdateSize(NodeAVL<T>* node);
 
-    // start_node부터 root node까지 모든 node의 size 갱신
-    void UpdateSizeUntilRoot(NodeAVL<T>* start_node);
-
     // 해당 node의 (left subtree의 height) - (right subtree의 height)의 값을 return
-    int GetBalanceFactor(NodeAVL<T>* node);
+    int GetBalanceFactor(NodeAVL<T>* node) const;
+
+    // balance factor에 해당하는 report의 개수를 증가
+    static void CountBalanceFactor(int balance_factor, SetAVLShapeReport& report);
+
+    // node를 root로 하는 subtree의 실제 height를 return하고 각 node의 balance factor를 report에 셈
+    // (WeakAVLBalancePolicy의 ShapeReport에서 사용)
+    int CollectBalanceFactors(const NodeAVL<T>* node, SetAVLShapeReport& report) const;
 
     // 해당 node의 depth를 return
     int GetDepth(NodeAVL<T>* node);
@@ -86,9 +482,13 @@ private:
     // key값을 가지고 있는 해당 node의 depth를 return
     int FindDepth(NodeAVL<T> *node, T key, int depth);
 
-    // new_node부터 root node까지 balance factor를 계산함
+    // start_node부터 root node까지 size, height를 갱신하면서 balance factor를 계산함
     // balance factor의 절댓값이 2 이상인 경우 Restructuring을 진행
-    void Restructuring(NodeAVL<T>* new_node);
+    void Restructuring(NodeAVL<T>* start_node);
+
+    // balance factor의 절댓값이 2인 grand_parent_node에서 rotation을 진행하고
+    // subtree의 새로운 root node를 return
+    NodeAVL<T>* RestructuringSubtree(NodeAVL<T>* grand_parent_node);
 
     // Left Left Case에 대하여 restructuring 진행
     void RestructuringForLeftLeftCase(
@@ -114,20 +514,142 @@ private:
         NodeAVL<T>* parent_node,
         NodeAVL<T>* grand_parent_node);
 
-    // node를 삭제 (node의 자식이 없는 경우)
+    // 새로 연결한 leaf node의 parent부터 BalancePolicy에 따라 rebalancing 진행
+    void RebalanceAfterInsert(NodeAVL<T>* node);
+
+    // node를 떼어낸 자리의 parent_node부터 BalancePolicy에 따라 rebalancing 진행
+    void RebalanceAfterErase(NodeAVL<T>* parent_node);
+
+    // relaxed balance에서 start_node부터 root node까지 size, height를 갱신하고
+    // balance factor의 절댓값이 2 이상인 node를 pending_nodes_에 기록
+    void MarkImbalance(NodeAVL<T>* start_node);
+
+    // 기록된 node 하나를 rebalancing
+    // 한 번의 Restructuring으로 고칠 수 없을 만큼 기울어졌으면 subtree를 다시 구성함
+    void RebalancePendingNode(NodeAVL<T>* node);
+
+    // rebalancing한 subtree의 위로 height가 바뀌는 동안 올라가며 다시 기록함
+    void FinishRebalancing(NodeAVL<T>* subtree_root);
+
+    // node를 root로 하는 subtree의 node를 균형 잡힌 모양으로 다시 연결하고 새로운 root를 return
+    // node의 메모리 위치는 바뀌지 않음
+    NodeAVL<T>* RebuildSubtree(NodeAVL<T>* node);
+
+    // 오름차순인 nodes[begin, end)를 균형 잡힌 subtree로 연결하고 root를 return
+    NodeAVL<T>* LinkBalancedSubtree(
+        const std::vector<NodeAVL<T>*>& nodes, int begin, int end, NodeAVL<T>* parent_node);
+
+    // start_node부터 root node까지 size만 갱신
+    void UpdateSizeToRoot(NodeAVL<T>* start_node);
+
+    // Augmentation이 lazy tag를 사용하면 root부터 node까지 내려가며 node와 그 조상의 tag를 자식에게 내려보냄
+    // (node를 연결하거나 떼어내기 전에 호출하여 경로 위의 tag가 옮겨지는 node에 잘못 적용되지 않게 함)
+    void PushDownPath(NodeAVL<T>* node);
+
+    // node를 root로 하는 subtree의 모든 tag를 내려보냄 (subtree를 다시 연결하기 전에 호출)
+    void PushDownSubtree(NodeAVL<T>* node);
+
+    // WeakAVLBalancePolicy의 삽입 후 rebalancing (node는 새로 연결한 leaf node)
+    // rank 차이가 0인 자식이 생기면 부모를 promote하며 올라가고, 필요하면 rotation 한 번으로 끝냄
+    void RebalanceRankAfterInsert(NodeAVL<T>* node);
+
+    // WeakAVLBalancePolicy의 삭제 후 rebalancing (node는 떼어낸 자리의 parent)
+    // rank 차이가 3인 자식이나 rank 1인 leaf가 생기면 demote하며 올라가고,
+    // 필요하면 single 또는 double rotation 한 번으로 끝냄
+    void RebalanceRankAfterErase(NodeAVL<T>* node);
+
+    // node를 parent 자리로 올리는 single rotation (size를 갱신하고 rank는 바꾸지 않음)
+    void RotateUp(NodeAVL<T>* node);
+
+    // node의 rank (nullptr이면 -1)
+    static int GetRank(const NodeAVL<T>* node) { return (node == nullptr) ? -1 : node->GetHeight(); }
+
+    // node를 Set에서 삭제하고 메모리를 해제
+    void EraseNode(NodeAVL<T>* node);
+
+    // 현재 원소로 filter_를 다시 만듦 (filter_enabled_인 경우에만 호출)
+    void RebuildMembershipFilter();
+
+    // hot_key_cache_를 통해 key를 가진 node의 depth와 rank를 구함 (없으면 false)
+    // cache에 없으면 filter, hash index 또는 tree 탐색으로 node를 찾아서 저장함
+    // rank는 out_rank가 nullptr가 아닐 때만 계산함 (parent의 left child를 읽어야 하므로 depth보다 비쌈)
+    bool FindWithHotKeyCache(const T& key, int& out_depth, int* out_rank);
+
+    // node에서 root까지 parent를 따라 올라가며 depth와 rank를 계산
+    void GetDepthAndRank(const NodeAVL<T>* node, int& out_depth, int& out_rank) const;
+
+    // 현재 node로 hash_index_를 다시 만듦 (hash_index_enabled_인 경우에만 호출)
+    void RebuildHashIndex();
+
+    // node의 메모리를 해제 (Compact로 옮긴 node이면 영역에서 소멸시킴)
+    void FreeNode(NodeAVL<T>* node);
+
+    // node가 들어있는 regions_의 위치 (new로 할당한 node이면 -1)
+    int FindRegion(const NodeAVL<T>* node) const;
+
+    // node를 capacity개 담을 수 있는 영역을 할당 (node는 아직 생성하지 않음)
+    static NodeRegion AllocateRegion(int capacity);
+
+    // 모든 영역을 해제 (모든 node를 해제한 뒤에 호출)
+    void ReleaseRegions();
+
+    // tree에서 떼어낸 node가 영역에 있으면 같은 key를 가진 node를 new로 할당하여 바꿔 return
+    // NodeHandleAVL과 다른 Set은 node를 delete로 해제하므로 영역의 node를 넘겨줄 수 없음
+    NodeAVL<T>* DetachFromRegion(NodeAVL<T>* node);
+
+    // node를 마지막 영역의 다음 자리로 옮기고 parent와 자식의 link를 바꿈
+    void RelocateNode(NodeAVL<T>* node);
+
+    // CompactIncrementally를 끝내고, node를 옮기던 영역에 남은 node가 없으면 영역을 해제
+    void FinishIncrementalCompaction();
+
+    // node를 root로 하는 subtree의 위쪽 levels단계를 van Emde Boas 순서로 out_nodes에 추가
+    // 위쪽 levels / 2단계를 먼저 추가한 뒤, 그 아래에 매달린 subtree를 왼쪽부터 차례로 추가함
+    void AppendVanEmdeBoasOrder(NodeAVL<T>* node, int levels, std::vector<NodeAVL<T>*>& out_nodes);
+
+    // node로부터 depth만큼 아래에 있는 subtree를 왼쪽부터 차례로 위쪽 levels단계씩 추가
+    void AppendVanEmdeBoasBottom(
+        NodeAVL<T>* node, int depth, int levels, std::vector<NodeAVL<T>*>& out_nodes);
+
+    // node를 tree에서 떼어내고 원소의 개수, 최솟값, 최댓값을 갱신
+    void UnlinkNode(NodeAVL<T>* node);
+
+    // node를 tree에서 떼어냄 (node의 자식이 없는 경우)
     void EraseNodeThatHasNoChild(NodeAVL<T>* node);
 
-    // node를 삭제 (node의 자식이 1개만 있는 경우)
+    // node를 tree에서 떼어냄 (node의 자식이 1개만 있는 경우)
     void EraseNodeThatHasOnlyOneChild(NodeAVL<T>* node);
 
-    // node를 삭제 (node의 자식이 2개 있는 경우)
+    // node를 tree에서 떼어냄 (node의 자식이 2개 있는 경우)
+    // successor node를 node의 자리로 옮겨서 연결함
     void EraseNodeThatHasTwoChildren(NodeAVL<T>* node);
 
     // node의 successor를 찾음
     NodeAVL<T>* FindSuccessor(NodeAVL<T>* node);
 
-    // Erase 기능을 수행할 때 필요에 따라 Restructuring을 진행함
-    void RestructuringForErase(NodeAVL<T>* node);
+    // QuerySorted에서 query가 하나만 남은 subtree의 탐색 상태
+    struct PendingQuery
+    {
+        NodeAVL<T>* node;
+        int depth;
+        int rank_offset;
+        int query_index;
+    };
+
+    // node를 root로 하는 subtree에서 sorted_keys[begin, end)에 대한 query를 처리
+    // rank_offset: subtree보다 왼쪽에 있는 원소의 개수
+    // query가 하나만 남은 subtree는 pending_queries에 모아둠
+    void QuerySortedTraversal(
+        NodeAVL<T>* node, int depth, int rank_offset,
+        const std::vector<T>& sorted_keys, int begin, int end,
+        std::vector<SetAVLQueryResult>& out_results,
+        std::vector<PendingQuery>& pending_queries) const;
+
+    // pending_queries의 탐색을 FindBatch처럼 번갈아 진행하면서 마무리함
+    void FinishPendingQueries(
+        const std::vector<T>& sorted_keys,
+        const std::vector<PendingQuery>& pending_queries,
+        std::vector<SetAVLQueryResult>& out_results) const;
 
     // AVL 트리 전위 순회
     void RankTraversal(NodeAVL<T>* current_node, const T key, int& rank);
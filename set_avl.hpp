@@ -10,10 +10,22 @@
 **************************************************/
 
 #include "set_avl.h"
+#include "set_avl_probes.h"
+#include "set_avl_snapshot.h"
 
+#include <algorithm>
+#include <climits>
+#include <cmath>
 #include <iostream>
+#include <iterator>
+#include <new>
+#include <type_traits>
 #include <vector>
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 // pair에 대한 출력 연산자 오버로딩
 template <typename T>
 std::ostream& operator<<(std::ostream& output_stream, const std::pair<T, T>& pair)
@@ -39,60 +51,86 @@ std::ostream& operator<<(std::ostream& output_stream, const std::vector<T>& vect
 }
 
 // 복사생성자 정의
-template <typename T>
-SetAVL<T>::SetAVL(const SetAVL<T>& setavl)
+template <typename T, typename BalancePolicy, typename Augmentation>
+SetAVL<T, BalancePolicy, Augmentation>::SetAVL(const SetAVL<T, BalancePolicy, Augmentation>& setavl) :
+    size_(0), root_(nullptr), finger_(nullptr), leftmost_(nullptr), rightmost_(nullptr),
+    rotation_count_(0), relaxed_balance_(false), rebalance_budget_(0),
+    compacting_(false), compact_cursor_(), filter_enabled_(false), filter_bits_per_key_(0),
+    hash_index_enabled_(false), hot_key_cache_enabled_(false), structure_version_(0)
 {
-    size_ = setavl.GetSize();
-
-    if (setavl.root_ != nullptr)
-    {
-        root_ = new NodeAVL<T>(setavl.root_->GetKey());
-        // Deep Copy를 통해 SetAVL을 복사함
-        DeepCopyForSetAVL(setavl.root_, root_);
-    }
-    else
-    {
-        root_ = nullptr;
-    }
+    *this = setavl;
 }
 
 // 대입연산자 정의
-template <typename T>
-SetAVL<T>& SetAVL<T>::operator=(const SetAVL<T>& setavl)
+template <typename T, typename BalancePolicy, typename Augmentation>
+SetAVL<T, BalancePolicy, Augmentation>& SetAVL<T, BalancePolicy, Augmentation>::operator=(const SetAVL& setavl)
 {
+    if (this == &setavl)
+    {
+        return *this;
+    }
+
+    // 기존 원소의 메모리 해제
+    Clear();
+
     size_ = setavl.GetSize();
 
     if (setavl.root_ != nullptr)
     {
-        root_ = new NodeAVL<T>(setavl.root_->GetKey());
+        root_ = AugmentationTraits::Clone(setavl.root_);
         // Deep Copy를 통해 SetAVL을 복사함
         DeepCopyForSetAVL(setavl.root_, root_);
+
+        // 복사한 tree에는 rebalancing을 기다리는 node의 기록이 없으므로 균형 잡힌 모양으로 만듦
+        if (!setavl.pending_nodes_.empty())
+        {
+            root_ = RebuildSubtree(root_);
+        }
     }
-    else
+
+    leftmost_ = GetLeftmostNode(root_);
+    rightmost_ = GetRightmostNode(root_);
+
+    // filter와 hash index는 복사하지 않고 이 Set의 설정대로 다시 만듦
+    if (filter_enabled_)
     {
-        root_ = nullptr;
+        RebuildMembershipFilter();
+    }
+
+    if (hash_index_enabled_)
+    {
+        RebuildHashIndex();
     }
+
+    return *this;
 }
 
 // 소멸자 정의
-template <typename T>
-SetAVL<T>::~SetAVL()
+template <typename T, typename BalancePolicy, typename Augmentation>
+SetAVL<T, BalancePolicy, Augmentation>::~SetAVL()
 {
     if (root_ != nullptr)
     {
         FreeMemoryForSetAVL(root_);
     }
+
+    ReleaseRegions();
 }
 
 // Set을 Deep Copy함
-template <typename T>
-void SetAVL<T>::DeepCopyForSetAVL(
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::DeepCopyForSetAVL(
     NodeAVL<T>* original_parent_node,
     NodeAVL<T>* copied_parent_node)
 {
+    // height, size는 원본과 같음
+    copied_parent_node->SetHeight(original_parent_node->GetHeight());
+    copied_parent_node->SetSize(original_parent_node->GetSize());
+
     if (original_parent_node->GetLeft() != nullptr)
     {
-        NodeAVL<T>* node = new NodeAVL<T>(original_parent_node->GetLeft()->GetKey());
+        NodeAVL<T>* node = AugmentationTraits::Clone(original_parent_node->GetLeft());
+        node->SetParent(copied_parent_node);
         copied_parent_node->SetLeft(node);
         DeepCopyForSetAVL(
             original_parent_node->GetLeft(), copied_parent_node->GetLeft());
@@ -100,7 +138,8 @@ void SetAVL<T>::DeepCopyForSetAVL(
 
     if (original_parent_node->GetRight() != nullptr)
     {
-        NodeAVL<T>* node = new NodeAVL<T>(original_parent_node->GetRight()->GetKey());
+        NodeAVL<T>* node = AugmentationTraits::Clone(original_parent_node->GetRight());
+        node->SetParent(copied_parent_node);
         copied_parent_node->SetRight(node);
         DeepCopyForSetAVL(
             original_parent_node->GetRight(), copied_parent_node->GetRight());
@@ -108,8 +147,8 @@ void SetAVL<T>::DeepCopyForSetAVL(
 }
 
 // 후위순회를 통해 SetAVL에 있는 노드의 메모리를 해제시킴
-template <typename T>
-void SetAVL<T>::FreeMemoryForSetAVL(NodeAVL<T>* parent_node)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::FreeMemoryForSetAVL(NodeAVL<T>* parent_node)
 {
     if (parent_node->GetLeft() != nullptr)
     {
@@ -121,12 +160,12 @@ void SetAVL<T>::FreeMemoryForSetAVL(NodeAVL<T>* parent_node)
         FreeMemoryForSetAVL(parent_node->GetRight());
     }
 
-    delete parent_node;
+    FreeNode(parent_node);
 }
 
 // key를 root로 하는 subtree에서 최솟값을 갖는 node의 값과 depth를 출력
-template <typename T>
-void SetAVL<T>::Minimum(const T key)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::Minimum(const T key)
 {
     NodeAVL<T>* node = root_;
     // key를 root로 하는 node찾기
@@ -156,8 +195,8 @@ void SetAVL<T>::Minimum(const T key)
 }
 
 // key를 root로 하는 subtree에서 최댓값을 갖는 node의 값과 depth를 출력
-template <typename T>
-void SetAVL<T>::Maximum(const T key)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::Maximum(const T key)
 {
     NodeAVL<T>* node = root_;
     // key를 root로 하는 node찾기
@@ -187,15 +226,43 @@ void SetAVL<T>::Maximum(const T key)
 }
 
 // 해당 key를 가지고 있는 node의 depth를 return
-template <typename T>
-int SetAVL<T>::Find(const T key)
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::Find(const T key)
 {
-    int depth = FindDepth(root_, key, 0);
+    SET_AVL_PROBE1(find_entry, SetAVLProbeKey(key));
+
+    int depth;
+
+    if (hot_key_cache_enabled_)
+    {
+        // 자주 찾는 key는 cache에 저장된 결과를 사용
+        if (!FindWithHotKeyCache(key, depth, nullptr))
+        {
+            depth = -1;
+        }
+    }
+    else if (filter_enabled_ && !filter_.MayContain(key))
+    {
+        // filter에 없는 key는 Set에 확실히 없으므로 tree를 탐색하지 않음
+        depth = -1;
+    }
+    else if (hash_index_enabled_)
+    {
+        // hash index로 찾은 node에서 root까지 올라가며 depth를 셈
+        NodeAVL<T>* node = hash_index_.Find(key);
+        depth = (node == nullptr) ? -1 : GetDepth(node);
+    }
+    else
+    {
+        depth = FindDepth(root_, key, 0);
+    }
+
+    SET_AVL_PROBE2(find_return, SetAVLProbeKey(key), depth);
     return depth;
 }
 
-template <typename T>
-int SetAVL<T>::FindDepth(NodeAVL<T>* node, T key, int depth)
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::FindDepth(NodeAVL<T>* node, T key, int depth)
 {
     if (node == nullptr)
     {
@@ -216,491 +283,2782 @@ int SetAVL<T>::FindDepth(NodeAVL<T>* node, T key, int depth)
     }
 }
 
-// key를 삽입하고 해당 node의 depth를 출력
-template <typename T>
-int SetAVL<T>::Insert(const T key)
+// keys의 각 key에 대한 Find 결과를 out_depths에 저장
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::FindBatch(
+    const std::vector<T>& keys, std::vector<int>& out_depths) const
 {
-    if (root_ == nullptr)
-    {
-        // Set에 아무런 원소도 없는 경우
-        root_ = new NodeAVL<T>(key);
+    const int key_count = static_cast<int>(keys.size());
+    out_depths.resize(key_count);
 
-        // 새로 삽입한 node의 height는 0
-        root_->SetHeight(0);
-        size_ = 1;
+    // 각 slot은 진행 중인 탐색 하나를 나타냄 (query_index가 -1이면 빈 slot)
+    NodeAVL<T>* slot_node[kFindBatchWidth];
+    int slot_depth[kFindBatchWidth];
+    int slot_query_index[kFindBatchWidth];
 
-        // 새로 삽입한 node의 depth 출력
-        // root node의 depth는 0으로 정의
-        return 0;
+    int next_query_index = 0;
+    int active_slot_count = 0;
+
+    for (int slot = 0; slot < kFindBatchWidth; slot++)
+    {
+        slot_query_index[slot] = -1;
     }
-    else
+
+    do
     {
-        NodeAVL<T>* current_node = root_;
-        NodeAVL<T>* new_node = new NodeAVL<T>(key);
+        active_slot_count = 0;
 
-        // 적절한 위치에 Node 삽입하기
-        while (1)
+        for (int slot = 0; slot < kFindBatchWidth; slot++)
         {
-            if (key == current_node->GetKey())
-            {
-                // 삽입하려고 하는 원소가 이미 Set에 들어있음
-                // new_node 메모리 해제
-                delete new_node;
-                return -1;
-            }
-            else if (key < current_node->GetKey())
+            if (slot_query_index[slot] == -1)
             {
-                // Left Child로 이동
-                if (current_node->GetLeft() == nullptr)
+                if (next_query_index == key_count)
                 {
-                    // Left Child가 없는 경우
-                    // parent node 설정
-                    new_node->SetParent(current_node);
-
-                    // Left Child에 노드 삽입
-                    current_node->SetLeft(new_node);
-
-                    // 새로운 node의 height는 leaf 노드이므로 height는 0
-                    new_node->SetHeight(0);
+                    continue;
+                }
 
-                    // Set에 들어있는 원소의 개수 1 증가
-                    size_++;
+                // 끝난 slot에서 다음 key의 탐색을 시작
+                slot_query_index[slot] = next_query_index++;
+                slot_node[slot] = root_;
+                slot_depth[slot] = 0;
+            }
 
-                    // new_node부터 root node까지 모든 node의 height 갱신
-                    UpdateHeightUntilRoot(new_node);
+            active_slot_count++;
 
-                    // new_node부터 root node까지 balance factor를 계산함
-                    // balance factor의 절댓값이 2 이상인 경우 Restructuring을 진행
-                    Restructuring(new_node);
+            NodeAVL<T>* node = slot_node[slot];
+            const T& key = keys[slot_query_index[slot]];
 
-                    // 새로 삽입한 node의 depth를 return
-                    return GetDepth(new_node);
-                }
-                else
-                {
-                    // Left Child가 있는 경우
-                    // Left Child로 이동
-                    current_node = current_node->GetLeft();
-                }
+            if (node == nullptr)
+            {
+                // 해당 key가 Set에 없음
+                out_depths[slot_query_index[slot]] = -1;
+                slot_query_index[slot] = -1;
+            }
+            else if (key == node->GetKey())
+            {
+                out_depths[slot_query_index[slot]] = slot_depth[slot];
+                slot_query_index[slot] = -1;
             }
             else
             {
-                // Right Child로 이동
-                if (current_node->GetRight() == nullptr)
-                {
-                    // Right Child가 없는 경우
-                    // parent node 설정
-                    new_node->SetParent(current_node);
-
-                    // Right Child에 노드 삽입
-                    current_node->SetRight(new_node);
+                // 다음 node를 prefetch해두고 다른 slot의 탐색을 진행
+                node = (key < node->GetKey()) ? node->GetLeft() : node->GetRight();
+                __builtin_prefetch(node);
+                slot_node[slot] = node;
+                slot_depth[slot]++;
+            }
+        }
+    } while (active_slot_count > 0);
+}
 
-                    // 새로운 node의 height는 leaf 노드이므로 height는 0
-                    new_node->SetHeight(0);
-                    
-                    // Set에 들어있는 원소의 개수 1 증가
-                    size_++;
+// key가 Set에 들어있으면 true
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::Contains(const T key) const
+{
+    if (filter_enabled_ && !filter_.MayContain(key))
+    {
+        return false;
+    }
 
-                    // new_node부터 root node까지 모든 node의 height 갱신
-                    UpdateHeightUntilRoot(new_node);
+    if (hash_index_enabled_)
+    {
+        return hash_index_.Find(key) != nullptr;
+    }
 
-                    // new_node부터 root node까지 balance factor를 계산함
-                    // balance factor의 절댓값이 2 이상인 경우 Restructuring을 진행
-                    Restructuring(new_node);
+    NodeAVL<T>* node = root_;
 
-                    // 새로 삽입한 node의 depth를 return
-                    return GetDepth(new_node);
-                }
-                else
-                {
-                    // Right Child가 있는 경우
-                    // Right Child로 이동
-                    current_node = current_node->GetRight();
-                }
-            }
-        }
+    while (node != nullptr)
+    {
+        if (key == node->GetKey())
+            return true;
+        else if (key < node->GetKey())
+            node = node->GetLeft();
+        else
+            node = node->GetRight();
     }
+
+    return false;
 }
 
-// 해당 key를 가지고 있는 node의 depth와 rank를 출력
-// rank: Set에서 해당 node보다 작은 key 값을 가진 node의 개수 + 1
-template <typename T>
-void SetAVL<T>::Rank(const T key)
+// 오름차순으로 정렬된 query 전체를 tree를 한 번 순회하면서 처리함
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::QuerySorted(
+    const std::vector<T>& sorted_keys,
+    std::vector<SetAVLQueryResult>& out_results) const
 {
-    NodeAVL<T>* root_node = root_;
-    int rank = 1;
+    out_results.resize(sorted_keys.size());
 
-    RankTraversal(root_node, key, rank);
-    
-    int depth = Find(key);
+    std::vector<PendingQuery> pending_queries;
+    QuerySortedTraversal(root_, 0, 0,
+        sorted_keys, 0, static_cast<int>(sorted_keys.size()),
+        out_results, pending_queries);
 
-    if (depth == -1)
-        std::cout << "0\n";
-    else
-        std::cout << depth << " " << rank;
+    FinishPendingQueries(sorted_keys, pending_queries, out_results);
 }
 
-// AVL 트리 전위 순회
-template <typename T>
-void SetAVL<T>::RankTraversal(NodeAVL<T>* current_node, const T key, int& rank)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::QuerySortedTraversal(
+    NodeAVL<T>* node, int depth, int rank_offset,
+    const std::vector<T>& sorted_keys, int begin, int end,
+    std::vector<SetAVLQueryResult>& out_results,
+    std::vector<PendingQuery>& pending_queries) const
 {
-    if (current_node == nullptr)
+    if (begin >= end)
+    {
         return;
-    if (current_node->GetKey() < key)
+    }
+
+    if (node == nullptr)
     {
-        rank++;
+        // 남은 query의 key는 Set에 없음
+        for (int i = begin; i < end; i++)
+        {
+            out_results[i] = SetAVLQueryResult{ -1, 0, false };
+        }
 
-        if (current_node->GetLeft() != nullptr)
-            RankTraversal(current_node->GetLeft(), key, rank);
+        return;
+    }
 
-        if (current_node->GetRight() != nullptr)
-            RankTraversal(current_node->GetRight(), key, rank);
+    if (end - begin == 1)
+    {
+        // 더 이상 나눌 query가 없으므로 나머지 탐색은 다른 query와 번갈아 진행함
+        pending_queries.push_back(PendingQuery{ node, depth, rank_offset, begin });
+        return;
     }
-    else
+
+    const T key = node->GetKey();
+
+    // [begin, equal_begin): key보다 작은 query, [equal_begin, equal_end): key와 같은 query
+    // [equal_end, end): key보다 큰 query
+    auto first = sorted_keys.begin();
+    int equal_begin = static_cast<int>(
+        std::lower_bound(first + begin, first + end, key) - first);
+    int equal_end = static_cast<int>(
+        std::upper_bound(first + equal_begin, first + end, key) - first);
+
+    // node와 left subtree의 원소 개수를 더한 rank
+    // left child 대신 어차피 방문할 right child의 size를 이용함
+    int rank = rank_offset;
+
+    if (equal_begin < end)
     {
-        // right child는 탐색할 필요 없음
-        if (current_node->GetLeft() != nullptr)
-            RankTraversal(current_node->GetLeft(), key, rank);
+        int right_subtree_size =
+            (node->GetRight() != nullptr) ? node->GetRight()->GetSize() : 0;
+        rank += node->GetSize() - right_subtree_size;
+    }
+
+    for (int i = equal_begin; i < equal_end; i++)
+    {
+        out_results[i] = SetAVLQueryResult{ depth, rank, true };
     }
+
+    QuerySortedTraversal(node->GetLeft(), depth + 1, rank_offset,
+        sorted_keys, begin, equal_begin, out_results, pending_queries);
+    QuerySortedTraversal(node->GetRight(), depth + 1, rank,
+        sorted_keys, equal_end, end, out_results, pending_queries);
 }
 
-// 해당 key를 가지고 있는 노드를 삭제하고 해당 노드의 depth를 return
-template <typename T>
-int SetAVL<T>::Erase(const T key)
+// pending_queries의 탐색을 FindBatch처럼 번갈아 진행하면서 마무리함
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::FinishPendingQueries(
+    const std::vector<T>& sorted_keys,
+    const std::vector<PendingQuery>& pending_queries,
+    std::vector<SetAVLQueryResult>& out_results) const
 {
-    // 삭제하려고 하는 노드
-    NodeAVL<T>* erase_node = root_;
+    const int pending_count = static_cast<int>(pending_queries.size());
 
-    // 삭제하려고 하는 노드를 검색
-    while (1)
+    // 각 slot의 탐색 상태 (query_index가 -1이면 빈 slot)
+    // right child로 이동한 경우 rank_offset에 부모의 size를 더해두고
+    // 도착한 node가 load된 뒤에 그 node의 size를 뺌
+    PendingQuery slots[kFindBatchWidth];
+    bool subtract_node_size[kFindBatchWidth];
+
+    int next_pending_index = 0;
+    int active_slot_count = 0;
+
+    for (int slot = 0; slot < kFindBatchWidth; slot++)
     {
-        if (key == erase_node->GetKey())
-        {
-            // 삭제하려고 하는 node를 찾음
-            break;
-        }
-        else if (key < erase_node->GetKey())
+        slots[slot].query_index = -1;
+    }
+
+    do
+    {
+        active_slot_count = 0;
+
+        for (int slot = 0; slot < kFindBatchWidth; slot++)
         {
-            // Left Child로 이동
-            if (erase_node->GetLeft() == nullptr)
+            PendingQuery& query = slots[slot];
+
+            if (query.query_index == -1)
             {
-                // Left Child가 없는 경우
-                // 삭제하려고 하는 노드를 찾지 못함
-                return -1;
+                if (next_pending_index == pending_count)
+                {
+                    continue;
+                }
+
+                query = pending_queries[next_pending_index++];
+                subtract_node_size[slot] = false;
             }
-            else
+
+            active_slot_count++;
+
+            NodeAVL<T>* node = query.node;
+
+            if (node == nullptr)
             {
-                // Left Child가 있는 경우
-                // Left Child로 이동
-                erase_node = erase_node->GetLeft();
+                out_results[query.query_index] = SetAVLQueryResult{ -1, 0, false };
+                query.query_index = -1;
+                continue;
             }
-        }
-        else
-        {
-            // Right Child로 이동
-            if (erase_node->GetRight() == nullptr)
+
+            if (subtract_node_size[slot])
             {
-                // Right Child가 없는 경우
-                // 삭제하려고 하는 노드를 찾지 못함
-                return -1;
+                query.rank_offset -= node->GetSize();
+            }
+
+            const T& key = sorted_keys[query.query_index];
+
+            if (key == node->GetKey())
+            {
+                int right_subtree_size =
+                    (node->GetRight() != nullptr) ? node->GetRight()->GetSize() : 0;
+                out_results[query.query_index] = SetAVLQueryResult{
+                    query.depth, query.rank_offset + node->GetSize() - right_subtree_size, true };
+                query.query_index = -1;
             }
             else
             {
-                // Right Child가 있는 경우
-                // Right Child로 이동
-                erase_node = erase_node->GetRight();
+                if (key < node->GetKey())
+                {
+                    query.node = node->GetLeft();
+                    subtract_node_size[slot] = false;
+                }
+                else
+                {
+                    query.node = node->GetRight();
+                    query.rank_offset += node->GetSize();
+                    subtract_node_size[slot] = true;
+                }
+
+                __builtin_prefetch(query.node);
+                query.depth++;
             }
         }
+    } while (active_slot_count > 0);
+}
+
+// QuerySorted의 결과 중 depth만 저장
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::FindSorted(
+    const std::vector<T>& sorted_keys, std::vector<int>& out_depths) const
+{
+    std::vector<SetAVLQueryResult> results;
+    QuerySorted(sorted_keys, results);
+
+    out_depths.resize(results.size());
+
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        out_depths[i] = results[i].depth;
     }
+}
 
-    // 삭제하려고 하는 노드의 depth를 저장
-    int erase_node_depth = GetDepth(erase_node);
+// QuerySorted의 결과 중 rank만 저장
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RankSorted(
+    const std::vector<T>& sorted_keys, std::vector<int>& out_ranks) const
+{
+    std::vector<SetAVLQueryResult> results;
+    QuerySorted(sorted_keys, results);
+
+    out_ranks.resize(results.size());
 
-    if ((erase_node->GetLeft() == nullptr)
-    && (erase_node->GetRight() == nullptr))
+    for (std::size_t i = 0; i < results.size(); i++)
     {
-        // 삭제하려고 하는 노드의 자식이 없는 경우
-        EraseNodeThatHasNoChild(erase_node);
+        out_ranks[i] = results[i].rank;
     }
-    else if ((erase_node->GetLeft() != nullptr)
-    && (erase_node->GetRight() != nullptr))
+}
+
+// QuerySorted의 결과 중 found만 저장
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::ContainsSorted(
+    const std::vector<T>& sorted_keys, std::vector<bool>& out_found) const
+{
+    std::vector<SetAVLQueryResult> results;
+    QuerySorted(sorted_keys, results);
+
+    out_found.resize(results.size());
+
+    for (std::size_t i = 0; i < results.size(); i++)
     {
-        // 삭제하려고 하는 노드의 자식이 2개인 경우
-        EraseNodeThatHasTwoChildren(erase_node);
+        out_found[i] = results[i].found;
+    }
+}
+
+// key를 삽입하고 해당 node의 depth를 출력
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::Insert(const T key)
+{
+    SET_AVL_PROBE1(insert_entry, SetAVLProbeKey(key));
+
+    NodeAVL<T>* parent_node = nullptr;
+    bool is_left_child = false;
+    int depth = -1;
+
+    // root node부터 삽입할 위치를 찾음
+    if (root_ == nullptr || FindInsertPosition(root_, key, parent_node, is_left_child))
+    {
+        // key만으로 node를 만들 수 없는 Augmentation(기본 생성자가 없는 MapAVL의 value)이면 삽입하지 않음
+        NodeAVL<T>* node = AugmentationTraits::Create(key);
+
+        if (node != nullptr)
+        {
+            depth = LinkNode(parent_node, is_left_child, node);
+        }
+    }
+
+    SET_AVL_PROBE2(insert_return, SetAVLProbeKey(key), depth);
+    return depth;
+}
+
+// hint 근처에서 삽입할 위치를 찾아 key를 삽입하고 해당 node의 depth를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::Insert(Hint hint, const T key)
+{
+    SET_AVL_PROBE1(insert_entry, SetAVLProbeKey(key));
+
+    NodeAVL<T>* parent_node = nullptr;
+    bool is_left_child = false;
+    bool has_position = true;
+    int depth = -1;
+
+    if (root_ == nullptr)
+    {
+        // 빈 Set이므로 root node로 삽입
+    }
+    else if (hint == nullptr || key < leftmost_->GetKey() || rightmost_->GetKey() < key)
+    {
+        // hint가 없거나 key가 최솟값, 최댓값 바깥이면 root node부터 삽입할 위치를 찾음
+        has_position = FindInsertPosition(root_, key, parent_node, is_left_child);
+    }
+    else
+    {
+        has_position = FindInsertPositionNearNode(
+            const_cast<NodeAVL<T>*>(hint), key, parent_node, is_left_child);
+    }
+
+    // key만으로 node를 만들 수 없는 Augmentation이면 삽입하지 않음
+    NodeAVL<T>* node = has_position ? AugmentationTraits::Create(key) : nullptr;
+
+    if (node != nullptr)
+    {
+        depth = LinkNode(parent_node, is_left_child, node);
+    }
+
+    SET_AVL_PROBE2(insert_return, SetAVLProbeKey(key), depth);
+    return depth;
+}
+
+// 마지막으로 삽입한 node 근처에서 삽입할 위치를 찾아 key를 삽입
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::InsertNearFinger(const T key)
+{
+    return Insert(finger_, key);
+}
+
+// 마지막으로 삽입한 node의 위치를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+typename SetAVL<T, BalancePolicy, Augmentation>::Hint
+SetAVL<T, BalancePolicy, Augmentation>::GetFinger() const
+{
+    return finger_;
+}
+
+// handle이 가진 node를 메모리 할당 없이 Set에 연결하고 depth를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::Insert(NodeHandleAVL<T, Augmentation>& handle)
+{
+    if (handle.IsEmpty())
+    {
+        return -1;
+    }
+
+    NodeAVL<T>* parent_node = nullptr;
+    bool is_left_child = false;
+
+    if (root_ != nullptr
+        && !FindInsertPosition(root_, handle.node_->GetKey(), parent_node, is_left_child))
+    {
+        // 같은 key가 이미 Set에 있으므로 node는 handle에 그대로 남음
+        return -1;
+    }
+
+    NodeAVL<T>* node = handle.node_;
+    handle.node_ = nullptr;
+
+    return LinkNode(parent_node, is_left_child, node);
+}
+
+// key를 가진 node를 Set에서 떼어내어 handle로 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeHandleAVL<T, Augmentation> SetAVL<T, BalancePolicy, Augmentation>::Extract(const T key)
+{
+    NodeAVL<T>* node = root_;
+
+    while (node != nullptr && !(key == node->GetKey()))
+    {
+        node = (key < node->GetKey()) ? node->GetLeft() : node->GetRight();
+    }
+
+    if (node == nullptr)
+    {
+        // key가 Set에 없으므로 빈 handle을 return
+        return NodeHandleAVL<T, Augmentation>();
+    }
+
+    UnlinkNode(node);
+
+    return NodeHandleAVL<T, Augmentation>(DetachFromRegion(node));
+}
+
+// other의 node 중 이 Set에 없는 key를 가진 node를 메모리 할당 없이 옮겨옴
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::Merge(SetAVL<T, BalancePolicy, Augmentation>& other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+
+    // node를 떼어내도 다른 node의 위치는 변하지 않으므로 다음 node를 미리 찾아둠
+    NodeAVL<T>* node = other.leftmost_;
+
+    while (node != nullptr)
+    {
+        NodeAVL<T>* next_node = other.GetNextNodeInOrder(node);
+        NodeAVL<T>* parent_node = nullptr;
+        bool is_left_child = false;
+
+        if (root_ == nullptr
+            || FindInsertPosition(root_, node->GetKey(), parent_node, is_left_child))
+        {
+            other.UnlinkNode(node);
+            LinkNode(parent_node, is_left_child, other.DetachFromRegion(node));
+        }
+
+        node = next_node;
+    }
+}
+
+// start_node를 root로 하는 subtree에서 key를 가진 node를 삽입할 위치를 찾음
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::FindInsertPosition(
+    NodeAVL<T>* start_node, const T key,
+    NodeAVL<T>*& out_parent_node, bool& out_is_left_child) const
+{
+    if (start_node == root_)
+    {
+        // 최댓값보다 큰 key와 최솟값보다 작은 key는 탐색 없이 바로 삽입
+        if (rightmost_->GetKey() < key)
+        {
+            out_parent_node = rightmost_;
+            out_is_left_child = false;
+            return true;
+        }
+
+        if (key < leftmost_->GetKey())
+        {
+            out_parent_node = leftmost_;
+            out_is_left_child = true;
+            return true;
+        }
+    }
+
+    NodeAVL<T>* current_node = start_node;
+
+    // 적절한 위치 찾기
+    while (1)
+    {
+        if (key == current_node->GetKey())
+        {
+            // 삽입하려고 하는 원소가 이미 Set에 들어있음
+            out_parent_node = current_node;
+            return false;
+        }
+        else if (key < current_node->GetKey())
+        {
+            // Left Child로 이동
+            if (current_node->GetLeft() == nullptr)
+            {
+                // Left Child가 없는 경우 Left Child 자리에 삽입
+                out_parent_node = current_node;
+                out_is_left_child = true;
+                return true;
+            }
+            else
+            {
+                // Left Child가 있는 경우
+                // Left Child로 이동
+                current_node = current_node->GetLeft();
+            }
+        }
+        else
+        {
+            // Right Child로 이동
+            if (current_node->GetRight() == nullptr)
+            {
+                // Right Child가 없는 경우 Right Child 자리에 삽입
+                out_parent_node = current_node;
+                out_is_left_child = false;
+                return true;
+            }
+            else
+            {
+                // Right Child가 있는 경우
+                // Right Child로 이동
+                current_node = current_node->GetRight();
+            }
+        }
+    }
+}
+
+// finger_node에서 위로 올라가면서 key가 들어갈 범위를 가진 subtree를 찾은 뒤
+// 그 subtree 안에서 삽입할 위치를 찾음
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::FindInsertPositionNearNode(
+    NodeAVL<T>* finger_node, const T key,
+    NodeAVL<T>*& out_parent_node, bool& out_is_left_child) const
+{
+    if (key == finger_node->GetKey())
+    {
+        return false;
+    }
+
+    const bool is_key_larger = finger_node->GetKey() < key;
+
+    // subtree_root를 root로 하는 subtree의 모든 key는
+    // 지금까지 지나온 ancestor의 key로 정해지는 범위 안에 있음
+    NodeAVL<T>* subtree_root = finger_node;
+
+    // finger_node와 key 사이에 있는 ancestor를 지나왔는지 여부
+    bool has_key_between = false;
+
+    while (subtree_root->GetParent() != nullptr)
+    {
+        NodeAVL<T>* parent_node = subtree_root->GetParent();
+        const bool is_left_child = (parent_node->GetLeft() == subtree_root);
+
+        if (is_key_larger == is_left_child)
+        {
+            // key 쪽의 경계가 되는 ancestor
+            // (key가 더 크면 parent_node의 key는 subtree의 모든 key보다 큼)
+            if (key == parent_node->GetKey())
+            {
+                return false;
+            }
+
+            if ((key < parent_node->GetKey()) == is_key_larger)
+            {
+                // key가 subtree의 범위 안에 있음
+                break;
+            }
+
+            has_key_between = true;
+        }
+
+        // key 반대쪽의 ancestor는 범위를 넓히기만 하므로 그대로 올라감
+        subtree_root = parent_node;
+    }
+
+    if (!has_key_between)
+    {
+        // finger_node와 key 사이에 다른 key가 없으므로
+        // finger_node의 해당 child 자리가 비어있으면 바로 삽입
+        if (is_key_larger && finger_node->GetRight() == nullptr)
+        {
+            out_parent_node = finger_node;
+            out_is_left_child = false;
+            return true;
+        }
+
+        if (!is_key_larger && finger_node->GetLeft() == nullptr)
+        {
+            out_parent_node = finger_node;
+            out_is_left_child = true;
+            return true;
+        }
+    }
+
+    return FindInsertPosition(subtree_root, key, out_parent_node, out_is_left_child);
+}
+
+// parent_node의 비어있는 child 자리에 node를 leaf로 연결하고 depth를 return
+// parent_node가 nullptr이면 빈 Set의 root node로 연결
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::LinkNode(
+    NodeAVL<T>* parent_node, bool is_left_child, NodeAVL<T>* node)
+{
+    // 조상의 tag가 새로운 node에 적용되지 않도록 먼저 내려보냄
+    PushDownPath(parent_node);
+
+    // 새로운 node는 leaf 노드이므로 height는 0, size는 1
+    node->SetParent(parent_node);
+    node->SetLeft(nullptr);
+    node->SetRight(nullptr);
+    node->SetHeight(0);
+    node->SetSize(1);
+    AugmentationTraits::Update(node);
+
+    // Set에 들어있는 원소의 개수 1 증가
+    size_++;
+    finger_ = node;
+    structure_version_++;
+
+    if (filter_enabled_)
+    {
+        filter_.Add(node->GetKey());
+    }
+
+    if (hash_index_enabled_)
+    {
+        hash_index_.Insert(node);
+    }
+
+    if (parent_node == nullptr)
+    {
+        // Set에 아무런 원소도 없는 경우
+        // root node의 depth는 0으로 정의
+        root_ = node;
+        leftmost_ = node;
+        rightmost_ = node;
+        return 0;
+    }
+
+    if (is_left_child)
+    {
+        parent_node->SetLeft(node);
+
+        // 최솟값의 left child는 새로운 최솟값
+        if (parent_node == leftmost_)
+        {
+            leftmost_ = node;
+        }
+    }
+    else
+    {
+        parent_node->SetRight(node);
+
+        // 최댓값의 right child는 새로운 최댓값
+        if (parent_node == rightmost_)
+        {
+            rightmost_ = node;
+        }
+    }
+
+    // parent_node부터 root node까지 size, height를 갱신하면서 rebalancing 진행
+    RebalanceAfterInsert(node);
+
+    // 원소가 filter를 만들 때 정한 개수를 넘으면 더 큰 filter로 다시 만듦
+    if (filter_enabled_ && filter_.NeedsRebuild())
+    {
+        RebuildMembershipFilter();
+    }
+
+    // 새로 삽입한 node의 depth를 return
+    return GetDepth(node);
+}
+
+// 해당 key를 가지고 있는 node의 depth와 rank를 출력
+// rank: Set에서 해당 node보다 작은 key 값을 가진 node의 개수 + 1
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::Rank(const T key)
+{
+    SET_AVL_PROBE1(rank_entry, SetAVLProbeKey(key));
+
+    if (hot_key_cache_enabled_)
+    {
+        int depth = -1;
+        int rank = 0;
+        const bool found = FindWithHotKeyCache(key, depth, &rank);
+
+        SET_AVL_PROBE3(rank_return, SetAVLProbeKey(key), depth, found ? rank : 0);
+
+        if (!found)
+            std::cout << "0\n";
+        else
+            std::cout << depth << " " << rank;
+        return;
+    }
+
+    NodeAVL<T>* root_node = root_;
+    int rank = 1;
+
+    RankTraversal(root_node, key, rank);
+    
+    int depth = Find(key);
+
+    SET_AVL_PROBE3(rank_return, SetAVLProbeKey(key), depth, depth == -1 ? 0 : rank);
+
+    if (depth == -1)
+        std::cout << "0\n";
+    else
+        std::cout << depth << " " << rank;
+}
+
+// AVL 트리 전위 순회
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RankTraversal(NodeAVL<T>* current_node, const T key, int& rank)
+{
+    if (current_node == nullptr)
+        return;
+    if (current_node->GetKey() < key)
+    {
+        rank++;
+
+        if (current_node->GetLeft() != nullptr)
+            RankTraversal(current_node->GetLeft(), key, rank);
+
+        if (current_node->GetRight() != nullptr)
+            RankTraversal(current_node->GetRight(), key, rank);
+    }
+    else
+    {
+        // right child는 탐색할 필요 없음
+        if (current_node->GetLeft() != nullptr)
+            RankTraversal(current_node->GetLeft(), key, rank);
+    }
+}
+
+// 해당 key를 가지고 있는 노드를 삭제하고 해당 노드의 depth를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::Erase(const T key)
+{
+    SET_AVL_PROBE1(erase_entry, SetAVLProbeKey(key));
+
+    if (root_ == nullptr)
+    {
+        // Set이 비어있으므로 삭제할 노드가 없음
+        SET_AVL_PROBE2(erase_return, SetAVLProbeKey(key), -1);
+        return -1;
+    }
+
+    // 삭제하려고 하는 노드
+    NodeAVL<T>* erase_node = root_;
+
+    // 삭제하려고 하는 노드를 검색
+    while (1)
+    {
+        if (key == erase_node->GetKey())
+        {
+            // 삭제하려고 하는 node를 찾음
+            break;
+        }
+        else if (key < erase_node->GetKey())
+        {
+            // Left Child로 이동
+            if (erase_node->GetLeft() == nullptr)
+            {
+                // Left Child가 없는 경우
+                // 삭제하려고 하는 노드를 찾지 못함
+                SET_AVL_PROBE2(erase_return, SetAVLProbeKey(key), -1);
+                return -1;
+            }
+            else
+            {
+                // Left Child가 있는 경우
+                // Left Child로 이동
+                erase_node = erase_node->GetLeft();
+            }
+        }
+        else
+        {
+            // Right Child로 이동
+            if (erase_node->GetRight() == nullptr)
+            {
+                // Right Child가 없는 경우
+                // 삭제하려고 하는 노드를 찾지 못함
+                SET_AVL_PROBE2(erase_return, SetAVLProbeKey(key), -1);
+                return -1;
+            }
+            else
+            {
+                // Right Child가 있는 경우
+                // Right Child로 이동
+                erase_node = erase_node->GetRight();
+            }
+        }
+    }
+
+    // 삭제하려고 하는 노드의 depth를 저장
+    int erase_node_depth = GetDepth(erase_node);
+
+    EraseNode(erase_node);
+
+    // 삭제한 노드의 depth를 return
+    SET_AVL_PROBE2(erase_return, SetAVLProbeKey(key), erase_node_depth);
+    return erase_node_depth;
+}
+
+// node를 Set에서 삭제하고 메모리를 해제
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::EraseNode(NodeAVL<T>* node)
+{
+    UnlinkNode(node);
+    FreeNode(node);
+}
+
+// node의 메모리를 해제 (Compact로 옮긴 node이면 영역에서 소멸시킴)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::FreeNode(NodeAVL<T>* node)
+{
+    const int index = FindRegion(node);
+
+    if (index < 0)
+    {
+        delete node;
+        return;
+    }
+
+    static_cast<NodeType*>(node)->~NodeType();
+    regions_[index].live_count--;
+
+    // CompactIncrementally가 node를 옮기고 있는 영역은 끝날 때까지 남겨둠
+    const bool is_compacting_region = compacting_ && index == static_cast<int>(regions_.size()) - 1;
+
+    if (regions_[index].live_count == 0 && !is_compacting_region)
+    {
+        ::operator delete(regions_[index].nodes);
+        regions_.erase(regions_.begin() + index);
+    }
+}
+
+// node가 들어있는 regions_의 위치 (new로 할당한 node이면 -1)
+// Compact를 반복해도 살아있는 node가 있는 영역만 남으므로 regions_는 보통 1 ~ 2개
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::FindRegion(const NodeAVL<T>* node) const
+{
+    for (int i = 0; i < static_cast<int>(regions_.size()); i++)
+    {
+        if (node >= regions_[i].nodes && node < regions_[i].nodes + regions_[i].capacity)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+// node를 capacity개 담을 수 있는 영역을 할당 (node는 아직 생성하지 않음)
+template <typename T, typename BalancePolicy, typename Augmentation>
+typename SetAVL<T, BalancePolicy, Augmentation>::NodeRegion
+SetAVL<T, BalancePolicy, Augmentation>::AllocateRegion(int capacity)
+{
+    NodeRegion region;
+    region.nodes = static_cast<NodeType*>(::operator new(sizeof(NodeType) * capacity));
+    region.capacity = capacity;
+    region.used = 0;
+    region.live_count = 0;
+
+    return region;
+}
+
+// 모든 영역을 해제 (모든 node를 해제한 뒤에 호출)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::ReleaseRegions()
+{
+    for (const NodeRegion& region : regions_)
+    {
+        ::operator delete(region.nodes);
+    }
+
+    regions_.clear();
+    compacting_ = false;
+}
+
+// tree에서 떼어낸 node가 영역에 있으면 같은 key를 가진 node를 new로 할당하여 바꿔 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::DetachFromRegion(NodeAVL<T>* node)
+{
+    if (regions_.empty() || FindRegion(node) < 0)
+    {
+        return node;
+    }
+
+    NodeAVL<T>* detached_node = AugmentationTraits::Relocate(::operator new(sizeof(NodeType)), node);
+    FreeNode(node);
+
+    return detached_node;
+}
+
+// node를 tree에서 떼어냄 (node의 메모리는 해제하지 않음)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::UnlinkNode(NodeAVL<T>* node)
+{
+    if (hash_index_enabled_)
+    {
+        hash_index_.Erase(node);
+    }
+
+    // cache는 떼어낸 node를 가리키는 slot만 비우고 나머지 slot의 depth, rank는 version으로 무효화
+    hot_key_cache_.Erase(node);
+    structure_version_++;
+
+    // node와 node의 자리로 올라오는 successor가 위쪽의 tag를 잃지 않도록 먼저 내려보냄
+    if (AugmentationTraits::kLazy)
+    {
+        const bool has_two_children = (node->GetLeft() != nullptr) && (node->GetRight() != nullptr);
+        PushDownPath(has_two_children ? FindSuccessor(node) : node);
+    }
+
+    // 떼어낸 node는 더 이상 rebalancing하지 않음
+    // 자식이 2개이면 successor가 node의 자리와 기울어짐을 이어받으므로 기록도 이어받음
+    if (!pending_nodes_.empty() && (pending_nodes_.erase(node) > 0)
+        && (node->GetLeft() != nullptr) && (node->GetRight() != nullptr))
+    {
+        pending_nodes_.insert(FindSuccessor(node));
+    }
+
+    // 삭제하려고 하는 노드가 최솟값 또는 최댓값이면 다음 최솟값, 최댓값을 미리 찾아둠
+    // 자식이 2개인 노드는 최솟값, 최댓값이 될 수 없음
+    if (node == leftmost_)
+    {
+        leftmost_ = GetNextNodeInOrder(node);
+    }
+
+    if (node == rightmost_)
+    {
+        rightmost_ = GetPreviousNodeInOrder(node);
+    }
+
+    if (node == finger_)
+    {
+        finger_ = nullptr;
+    }
+
+    if ((node->GetLeft() == nullptr)
+    && (node->GetRight() == nullptr))
+    {
+        // 삭제하려고 하는 노드의 자식이 없는 경우
+        EraseNodeThatHasNoChild(node);
+    }
+    else if ((node->GetLeft() != nullptr)
+    && (node->GetRight() != nullptr))
+    {
+        // 삭제하려고 하는 노드의 자식이 2개인 경우
+        EraseNodeThatHasTwoChildren(node);
+    }
+    else
+    {
+        // 삭제하려고 하는 노드의 자식이 1개인 경우
+        EraseNodeThatHasOnlyOneChild(node);
+    }
+
+    // 원소의 개수 1 감소
+    size_--;
+
+    // filter에서 key를 지울 수 없으므로 삭제된 key가 많이 쌓이면 다시 만듦
+    if (filter_enabled_)
+    {
+        filter_.MarkErased();
+
+        if (filter_.NeedsRebuild())
+        {
+            RebuildMembershipFilter();
+        }
+    }
+}
+
+// 최솟값을 out_key에 저장 (Set이 비어있으면 false)
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::GetMin(T& out_key) const
+{
+    if (leftmost_ == nullptr)
+    {
+        return false;
+    }
+
+    out_key = leftmost_->GetKey();
+    return true;
+}
+
+// 최댓값을 out_key에 저장 (Set이 비어있으면 false)
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::GetMax(T& out_key) const
+{
+    if (rightmost_ == nullptr)
+    {
+        return false;
+    }
+
+    out_key = rightmost_->GetKey();
+    return true;
+}
+
+// 최솟값을 out_key에 저장하고 Set에서 삭제 (Set이 비어있으면 false)
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::PopMin(T& out_key)
+{
+    if (leftmost_ == nullptr)
+    {
+        return false;
+    }
+
+    out_key = leftmost_->GetKey();
+    EraseNode(leftmost_);
+
+    return true;
+}
+
+// 최댓값을 out_key에 저장하고 Set에서 삭제 (Set이 비어있으면 false)
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::PopMax(T& out_key)
+{
+    if (rightmost_ == nullptr)
+    {
+        return false;
+    }
+
+    out_key = rightmost_->GetKey();
+    EraseNode(rightmost_);
+
+    return true;
+}
+
+// Set의 모든 원소를 삭제
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::Clear()
+{
+    if (root_ != nullptr)
+    {
+        FreeMemoryForSetAVL(root_);
+    }
+
+    root_ = nullptr;
+    finger_ = nullptr;
+    leftmost_ = nullptr;
+    rightmost_ = nullptr;
+    size_ = 0;
+    pending_nodes_.clear();
+    ReleaseRegions();
+
+    if (filter_enabled_)
+    {
+        RebuildMembershipFilter();
+    }
+
+    if (hash_index_enabled_)
+    {
+        RebuildHashIndex();
+    }
+
+    // 모든 node가 바뀌었으므로 cache를 비움
+    hot_key_cache_.Clear();
+}
+
+// 오름차순으로 정렬된 [first, last)의 key로 Set의 내용을 교체
+template <typename T, typename BalancePolicy, typename Augmentation>
+template <typename Iterator>
+void SetAVL<T, BalancePolicy, Augmentation>::AssignSorted(Iterator first, Iterator last)
+{
+    static_assert(!AugmentationTraits::kStoresValue,
+        "AssignSorted would replace every node and reset the values of a map");
+
+    const int count = static_cast<int>(std::distance(first, last));
+
+    auto next_node = [&first]() -> NodeAVL<T>*
+    {
+        return AugmentationTraits::Create(*first++);
+    };
+
+    NodeAVL<T>* new_root = nullptr;
+
+    if (BuildBalancedSubtree(count, next_node, new_root))
+    {
+        ReplaceRoot(new_root, count);
+    }
+}
+
+// tree의 height, depth 분포, balance factor 분포와 메모리 사용량을 O(n)에 수집
+template <typename T, typename BalancePolicy, typename Augmentation>
+SetAVLShapeReport SetAVL<T, BalancePolicy, Augmentation>::ShapeReport() const
+{
+    SetAVLShapeReport report = {};
+    report.size = size_;
+    report.height = -1;
+    report.node_bytes = sizeof(NodeType);
+    report.size_consistent = (root_ == nullptr)
+        ? (size_ == 0) : (root_->GetSize() == size_);
+
+    // allocator가 실제로 할당한 byte 수의 합
+    std::size_t allocated_bytes = 0;
+    long long depth_sum = 0;
+
+    if (root_ != nullptr)
+    {
+        // WeakAVLBalancePolicy의 height_는 rank이므로 height와 balance factor를 구조에서 다시 계산
+        report.height = BalancePolicy::kRankBalanced
+            ? CollectBalanceFactors(root_, report) : root_->GetHeight();
+
+        // parent pointer를 이용한 중위 순회 (stack을 사용하지 않음)
+        NodeAVL<T>* node = root_;
+        int depth = 0;
+
+        while (node->GetLeft() != nullptr)
+        {
+            node = node->GetLeft();
+            depth++;
+        }
+
+        while (node != nullptr)
+        {
+            depth_sum += depth;
+            report.max_depth = std::max(report.max_depth, depth);
+
+            if (!BalancePolicy::kRankBalanced)
+            {
+                CountBalanceFactor(GetBalanceFactor(node), report);
+            }
+
+#if defined(__GLIBC__)
+            // glibc는 usable size 앞에 size_t 크기의 chunk header를 붙임
+            // Compact로 옮긴 node는 영역 안에 빈틈없이 놓이므로 node의 크기만 셈
+            allocated_bytes += (!regions_.empty() && FindRegion(node) >= 0)
+                ? sizeof(NodeType) : malloc_usable_size(node) + sizeof(std::size_t);
+#else
+            // allocator 정보를 얻을 수 없는 경우 16byte 정렬 + header로 추정
+            allocated_bytes += (sizeof(NodeType) + 15) / 16 * 16 + sizeof(std::size_t);
+#endif
+
+            // 중위 순회에서 다음 node로 이동
+            if (node->GetRight() != nullptr)
+            {
+                node = node->GetRight();
+                depth++;
+
+                while (node->GetLeft() != nullptr)
+                {
+                    node = node->GetLeft();
+                    depth++;
+                }
+            }
+            else
+            {
+                // right child로부터 올라오는 동안은 이미 방문한 node
+                while (node->GetParent() != nullptr
+                    && node->GetParent()->GetRight() == node)
+                {
+                    node = node->GetParent();
+                    depth--;
+                }
+
+                node = node->GetParent();
+                depth--;
+            }
+        }
+    }
+
+    if (size_ > 0)
+    {
+        report.optimal_height = static_cast<int>(std::floor(std::log2(size_)));
+        report.height_ratio = report.height / std::log2(size_ + 1.0);
+        report.average_depth = static_cast<double>(depth_sum) / size_;
+        report.allocated_bytes_per_node = static_cast<double>(allocated_bytes) / size_;
+    }
+
+    report.total_bytes = sizeof(*this) + allocated_bytes;
+    report.bytes_per_element = (size_ > 0)
+        ? static_cast<double>(report.total_bytes) / size_ : 0.0;
+
+    return report;
+}
+
+// balance factor에 해당하는 report의 개수를 증가
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::CountBalanceFactor(int balance_factor, SetAVLShapeReport& report)
+{
+    if (balance_factor == 1)
+        report.left_heavy_count++;
+    else if (balance_factor == 0)
+        report.balanced_count++;
+    else if (balance_factor == -1)
+        report.right_heavy_count++;
+    else
+        report.unbalanced_count++;
+}
+
+// 후위 순회로 subtree의 실제 height를 계산하면서 각 node의 balance factor를 report에 셈
+// 재귀의 깊이는 tree의 height (WeakAVLBalancePolicy에서 2 log2(n + 1) 이하)
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::CollectBalanceFactors(
+    const NodeAVL<T>* node,
+    SetAVLShapeReport& report) const
+{
+    if (node == nullptr)
+    {
+        return -1;
+    }
+
+    const int left_subtree_height = CollectBalanceFactors(node->GetLeft(), report);
+    const int right_subtree_height = CollectBalanceFactors(node->GetRight(), report);
+
+    CountBalanceFactor(left_subtree_height - right_subtree_height, report);
+
+    return std::max(left_subtree_height, right_subtree_height) + 1;
+}
+
+// 모든 node를 하나의 연속된 메모리 영역에 order 순서로 옮김
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::Compact(SetAVLCompactOrder order)
+{
+    // 진행 중인 CompactIncrementally는 이 영역으로 대신함
+    FinishIncrementalCompaction();
+
+    if (root_ == nullptr)
+    {
+        ReleaseRegions();
+        return;
+    }
+
+    // 옮길 순서대로 기존 node를 모음
+    std::vector<NodeAVL<T>*> nodes;
+    nodes.reserve(size_);
+
+    if (order == kSetAVLCompactVanEmdeBoas)
+    {
+        // WeakAVLBalancePolicy의 rank는 height 이상이므로 모든 node가 포함됨
+        AppendVanEmdeBoasOrder(root_, root_->GetHeight() + 1, nodes);
+    }
+    else
+    {
+        for (NodeAVL<T>* node = leftmost_; node != nullptr; node = GetNextNodeInOrder(node))
+        {
+            nodes.push_back(node);
+        }
+    }
+
+    const int count = static_cast<int>(nodes.size());
+    NodeRegion region = AllocateRegion(count);
+
+    // i번째 node를 영역의 i번째 자리에 생성하고,
+    // link를 바꿀 때 새 위치를 찾을 수 있도록 기존 node의 size_ 자리에 i를 기록해둠
+    for (int i = 0; i < count; i++)
+    {
+        NodeAVL<T>* node = AugmentationTraits::Relocate(region.nodes + i, nodes[i]);
+        node->SetHeight(nodes[i]->GetHeight());
+        node->SetSize(nodes[i]->GetSize());
+        nodes[i]->SetSize(i);
+    }
+
+    auto relocated = [&region](const NodeAVL<T>* node) -> NodeAVL<T>*
+    {
+        return (node == nullptr) ? nullptr : region.nodes + node->GetSize();
+    };
+
+    for (int i = 0; i < count; i++)
+    {
+        region.nodes[i].SetParent(relocated(nodes[i]->GetParent()));
+        region.nodes[i].SetLeft(relocated(nodes[i]->GetLeft()));
+        region.nodes[i].SetRight(relocated(nodes[i]->GetRight()));
+    }
+
+    root_ = relocated(root_);
+    finger_ = relocated(finger_);
+    leftmost_ = relocated(leftmost_);
+    rightmost_ = relocated(rightmost_);
+
+    if (!pending_nodes_.empty())
+    {
+        std::unordered_set<NodeAVL<T>*> pending_nodes;
+
+        for (NodeAVL<T>* node : pending_nodes_)
+        {
+            pending_nodes.insert(relocated(node));
+        }
+
+        pending_nodes_.swap(pending_nodes);
+    }
+
+    if (hash_index_enabled_)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            hash_index_.Replace(nodes[i], region.nodes + i);
+        }
+    }
+
+    // node의 위치가 모두 바뀌었으므로 cache를 비움 (depth, rank는 그대로)
+    hot_key_cache_.Clear();
+
+    // 기존 node를 해제하면 비게 된 이전 영역도 함께 해제됨
+    for (NodeAVL<T>* node : nodes)
+    {
+        FreeNode(node);
+    }
+
+    region.used = count;
+    region.live_count = count;
+    regions_.push_back(region);
+}
+
+// Compact(kSetAVLCompactInOrder)를 여러 번에 나누어 진행함
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::CompactIncrementally(std::chrono::microseconds time_budget)
+{
+    const auto deadline = std::chrono::steady_clock::now() + time_budget;
+    NodeAVL<T>* node = nullptr;
+
+    if (!compacting_)
+    {
+        if (root_ == nullptr)
+        {
+            return true;
+        }
+
+        regions_.push_back(AllocateRegion(size_));
+        compacting_ = true;
+        node = leftmost_;
+    }
+    else
+    {
+        // 이전 호출이 멈춘 key 이상인 첫 node부터 다시 시작
+        // (그 사이에 node가 삭제되거나 rotation이 일어났을 수 있으므로 pointer 대신 key를 기억함)
+        NodeAVL<T>* current = root_;
+
+        while (current != nullptr)
+        {
+            if (current->GetKey() < compact_cursor_)
+            {
+                current = current->GetRight();
+            }
+            else
+            {
+                node = current;
+                current = current->GetLeft();
+            }
+        }
+    }
+
+    int visited_count = 0;
+
+    while (node != nullptr && regions_.back().used < regions_.back().capacity)
+    {
+        // 시계를 읽는 비용을 줄이기 위해 일정한 개수의 node마다 시간을 확인
+        // (한 번의 호출에서 적어도 kCompactClockInterval개의 node는 진행함)
+        if (++visited_count % kCompactClockInterval == 0
+            && std::chrono::steady_clock::now() >= deadline)
+        {
+            compact_cursor_ = node->GetKey();
+            return false;
+        }
+
+        // 옮겨도 다음 node의 위치는 바뀌지 않으므로 미리 찾아둠
+        NodeAVL<T>* next_node = GetNextNodeInOrder(node);
+
+        // 이미 옮긴 node는 건너뜀 (앞선 영역이 해제되면 위치가 당겨지므로 항상 마지막 영역과 비교함)
+        if (FindRegion(node) != static_cast<int>(regions_.size()) - 1)
+        {
+            RelocateNode(node);
+        }
+
+        node = next_node;
+    }
+
+    FinishIncrementalCompaction();
+
+    return true;
+}
+
+// CompactIncrementally를 끝내고, node를 옮기던 영역의 node가 모두 삭제되었으면 영역을 해제
+// (FreeNode는 진행 중인 영역을 live_count가 0이 되어도 남겨둠)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::FinishIncrementalCompaction()
+{
+    if (!compacting_)
+    {
+        return;
+    }
+
+    compacting_ = false;
+
+    if (regions_.back().live_count == 0)
+    {
+        ::operator delete(regions_.back().nodes);
+        regions_.pop_back();
+    }
+}
+
+// node를 마지막 영역의 다음 자리로 옮기고 parent와 자식의 link를 바꿈
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RelocateNode(NodeAVL<T>* node)
+{
+    NodeRegion& region = regions_.back();
+    NodeAVL<T>* moved_node = AugmentationTraits::Relocate(region.nodes + region.used, node);
+    region.used++;
+    region.live_count++;
+
+    moved_node->SetHeight(node->GetHeight());
+    moved_node->SetSize(node->GetSize());
+    moved_node->SetParent(node->GetParent());
+    moved_node->SetLeft(node->GetLeft());
+    moved_node->SetRight(node->GetRight());
+
+    NodeAVL<T>* parent_node = node->GetParent();
+
+    if (parent_node == nullptr)
+    {
+        root_ = moved_node;
+    }
+    else if (parent_node->GetLeft() == node)
+    {
+        parent_node->SetLeft(moved_node);
+    }
+    else
+    {
+        parent_node->SetRight(moved_node);
+    }
+
+    if (node->GetLeft() != nullptr)
+    {
+        node->GetLeft()->SetParent(moved_node);
+    }
+
+    if (node->GetRight() != nullptr)
+    {
+        node->GetRight()->SetParent(moved_node);
+    }
+
+    if (finger_ == node)
+    {
+        finger_ = moved_node;
+    }
+
+    if (leftmost_ == node)
+    {
+        leftmost_ = moved_node;
+    }
+
+    if (rightmost_ == node)
+    {
+        rightmost_ = moved_node;
+    }
+
+    if (!pending_nodes_.empty() && pending_nodes_.erase(node) > 0)
+    {
+        pending_nodes_.insert(moved_node);
+    }
+
+    if (hash_index_enabled_)
+    {
+        hash_index_.Replace(node, moved_node);
+    }
+
+    hot_key_cache_.Erase(node);
+
+    // node가 이전 영역의 마지막 node이면 그 영역이 해제되므로 region은 더 이상 사용하지 않음
+    FreeNode(node);
+}
+
+// node를 root로 하는 subtree의 위쪽 levels단계를 van Emde Boas 순서로 out_nodes에 추가
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::AppendVanEmdeBoasOrder(
+    NodeAVL<T>* node, int levels, std::vector<NodeAVL<T>*>& out_nodes)
+{
+    if (node == nullptr)
+    {
+        return;
+    }
+
+    if (levels == 1)
+    {
+        out_nodes.push_back(node);
+        return;
+    }
+
+    const int top_levels = levels / 2;
+
+    AppendVanEmdeBoasOrder(node, top_levels, out_nodes);
+    AppendVanEmdeBoasBottom(node, top_levels, levels - top_levels, out_nodes);
+}
+
+// node로부터 depth만큼 아래에 있는 subtree를 왼쪽부터 차례로 위쪽 levels단계씩 추가
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::AppendVanEmdeBoasBottom(
+    NodeAVL<T>* node, int depth, int levels, std::vector<NodeAVL<T>*>& out_nodes)
+{
+    if (node == nullptr)
+    {
+        return;
+    }
+
+    if (depth == 0)
+    {
+        AppendVanEmdeBoasOrder(node, levels, out_nodes);
+        return;
+    }
+
+    AppendVanEmdeBoasBottom(node->GetLeft(), depth - 1, levels, out_nodes);
+    AppendVanEmdeBoasBottom(node->GetRight(), depth - 1, levels, out_nodes);
+}
+
+// 현재 원소로 pointer가 없는 읽기 전용 Set을 만듦
+template <typename T, typename BalancePolicy, typename Augmentation>
+FrozenSetAVL<T> SetAVL<T, BalancePolicy, Augmentation>::Freeze() const
+{
+    std::vector<T> keys;
+    keys.reserve(size_);
+
+    for (NodeAVL<T>* node = leftmost_; node != nullptr; node = GetNextNodeInOrder(node))
+    {
+        keys.push_back(node->GetKey());
+    }
+
+    return FrozenSetAVL<T>(keys.begin(), keys.end());
+}
+
+// 모든 key를 오름차순으로 checksum이 포함된 binary 파일에 기록
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::SaveSnapshot(const std::string& path) const
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+        "SaveSnapshot requires a trivially copyable key type");
+
+    set_avl_snapshot::Writer writer(path);
+
+    if (!writer.IsGood())
+    {
+        return false;
+    }
+
+    const std::uint8_t encoding = std::is_integral<T>::value
+        ? set_avl_snapshot::kEncodingDeltaVarint : set_avl_snapshot::kEncodingRaw;
+    const std::uint8_t key_size = sizeof(T);
+    const std::uint64_t count = size_;
+
+    writer.WriteRaw(set_avl_snapshot::kMagic, sizeof(set_avl_snapshot::kMagic));
+    writer.WriteRaw(&set_avl_snapshot::kVersion, sizeof(set_avl_snapshot::kVersion));
+    writer.WriteRaw(&encoding, sizeof(encoding));
+    writer.WriteRaw(&key_size, sizeof(key_size));
+    writer.WriteRaw(&count, sizeof(count));
+
+    // 중위 순회로 key를 오름차순으로 기록
+    T previous_key = T();
+    bool is_first_key = true;
+
+    for (NodeAVL<T>* node = GetLeftmostNode(root_); node != nullptr;
+        node = GetNextNodeInOrder(node))
+    {
+        T key = node->GetKey();
+        set_avl_snapshot::WriteKey(writer, key,
+            is_first_key ? nullptr : &previous_key, std::is_integral<T>());
+        previous_key = key;
+        is_first_key = false;
+    }
+
+    writer.Flush();
+
+    const std::uint64_t checksum = writer.GetChecksum();
+    writer.WriteRaw(&checksum, sizeof(checksum));
+    writer.Flush();
+
+    return writer.IsGood();
+}
+
+// snapshot 파일로 Set의 내용을 교체
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::LoadSnapshot(const std::string& path)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+        "LoadSnapshot requires a trivially copyable key type");
+    static_assert(!AugmentationTraits::kStoresValue,
+        "LoadSnapshot would replace every node and reset the values of a map");
+
+    set_avl_snapshot::Reader reader(path);
+
+    if (!reader.IsGood())
+    {
+        return false;
+    }
+
+    char magic[sizeof(set_avl_snapshot::kMagic)];
+    std::uint32_t version = 0;
+    std::uint8_t encoding = 0;
+    std::uint8_t key_size = 0;
+    std::uint64_t count = 0;
+
+    reader.ReadRaw(magic, sizeof(magic));
+    reader.ReadRaw(&version, sizeof(version));
+    reader.ReadRaw(&encoding, sizeof(encoding));
+    reader.ReadRaw(&key_size, sizeof(key_size));
+    reader.ReadRaw(&count, sizeof(count));
+
+    const std::uint8_t expected_encoding = std::is_integral<T>::value
+        ? set_avl_snapshot::kEncodingDeltaVarint : set_avl_snapshot::kEncodingRaw;
+
+    if (!reader.IsGood()
+        || std::memcmp(magic, set_avl_snapshot::kMagic, sizeof(magic)) != 0
+        || version != set_avl_snapshot::kVersion
+        || encoding != expected_encoding
+        || key_size != sizeof(T)
+        || count > static_cast<std::uint64_t>(INT_MAX))
+    {
+        return false;
+    }
+
+    // key 하나는 적어도 1byte(varint) 또는 sizeof(T) byte이고 끝에 checksum이 있으므로
+    // 남은 파일 크기로 저장할 수 없는 count는 node를 할당하기 전에 거부
+    const std::uint64_t min_key_size = std::is_integral<T>::value ? 1 : sizeof(T);
+    const std::uint64_t remaining_size = reader.GetRemainingSize();
+
+    if (remaining_size < sizeof(std::uint64_t)
+        || count > (remaining_size - sizeof(std::uint64_t)) / min_key_size)
+    {
+        return false;
+    }
+
+    // 파일에서 key를 하나씩 읽으면서 오름차순인지 확인
+    // 파일이 중간에 끊기거나 순서가 틀리면 바로 tree 구성을 멈춤
+    T previous_key = T();
+    bool is_first_key = true;
+
+    auto next_node = [&]() -> NodeAVL<T>*
+    {
+        T key = set_avl_snapshot::ReadKey(reader,
+            is_first_key ? nullptr : &previous_key, std::is_integral<T>());
+
+        if (!reader.IsGood() || (!is_first_key && !(previous_key < key)))
+        {
+            return nullptr;
+        }
+
+        previous_key = key;
+        is_first_key = false;
+        return AugmentationTraits::Create(key);
+    };
+
+    NodeAVL<T>* new_root = nullptr;
+
+    if (!BuildBalancedSubtree(static_cast<int>(count), next_node, new_root))
+    {
+        return false;
+    }
+
+    const std::uint64_t expected_checksum = reader.GetChecksum();
+    std::uint64_t checksum = 0;
+    reader.ReadRaw(&checksum, sizeof(checksum));
+
+    if (!reader.IsGood() || checksum != expected_checksum || !reader.IsAtEnd())
+    {
+        // 손상된 파일이므로 새로 만든 tree를 버리고 기존 Set을 유지
+        if (new_root != nullptr)
+        {
+            FreeMemoryForSetAVL(new_root);
+        }
+
+        return false;
+    }
+
+    ReplaceRoot(new_root, static_cast<int>(count));
+
+    return true;
+}
+
+// 기존 tree를 해제하고 new_root를 root로 하는 count개의 node로 Set을 교체
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::ReplaceRoot(NodeAVL<T>* new_root, int count)
+{
+    if (root_ != nullptr)
+    {
+        FreeMemoryForSetAVL(root_);
+    }
+
+    // new_root의 node는 모두 new로 할당되었으므로 남은 영역이 없음
+    ReleaseRegions();
+
+    root_ = new_root;
+    finger_ = nullptr;
+    leftmost_ = GetLeftmostNode(root_);
+    rightmost_ = GetRightmostNode(root_);
+    size_ = count;
+    pending_nodes_.clear();
+
+    if (filter_enabled_)
+    {
+        RebuildMembershipFilter();
+    }
+
+    if (hash_index_enabled_)
+    {
+        RebuildHashIndex();
+    }
+
+    // 모든 node가 바뀌었으므로 cache를 비움
+    hot_key_cache_.Clear();
+}
+
+// node를 root로 하는 subtree에서 key가 최소인 node를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::GetLeftmostNode(NodeAVL<T>* node) const
+{
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+
+    while (node->GetLeft() != nullptr)
+    {
+        node = node->GetLeft();
+    }
+
+    return node;
+}
+
+// 중위 순회에서 node의 다음 node를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::GetNextNodeInOrder(NodeAVL<T>* node) const
+{
+    if (node->GetRight() != nullptr)
+    {
+        return GetLeftmostNode(node->GetRight());
+    }
+
+    // right child로부터 올라오는 동안은 이미 방문한 node
+    while (node->GetParent() != nullptr && node->GetParent()->GetRight() == node)
+    {
+        node = node->GetParent();
+    }
+
+    return node->GetParent();
+}
+
+// node를 root로 하는 subtree에서 key가 최대인 node를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::GetRightmostNode(NodeAVL<T>* node) const
+{
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+
+    while (node->GetRight() != nullptr)
+    {
+        node = node->GetRight();
+    }
+
+    return node;
+}
+
+// 중위 순회에서 node의 이전 node를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::GetPreviousNodeInOrder(NodeAVL<T>* node) const
+{
+    if (node->GetLeft() != nullptr)
+    {
+        return GetRightmostNode(node->GetLeft());
+    }
+
+    // left child로부터 올라오는 동안은 node보다 큰 node
+    while (node->GetParent() != nullptr && node->GetParent()->GetLeft() == node)
+    {
+        node = node->GetParent();
+    }
+
+    return node->GetParent();
+}
+
+// next_node()가 key의 오름차순으로 돌려주는 count개의 node로 균형 잡힌 subtree를 만듦
+template <typename T, typename BalancePolicy, typename Augmentation>
+template <typename NodeSource>
+bool SetAVL<T, BalancePolicy, Augmentation>::BuildBalancedSubtree(
+    int count,
+    NodeSource& next_node,
+    NodeAVL<T>*& out_root)
+{
+    out_root = nullptr;
+
+    if (count == 0)
+    {
+        return true;
+    }
+
+    // left subtree, 현재 node, right subtree 순서로 node를 소비함
+    int left_count = count / 2;
+    NodeAVL<T>* left_subtree_root = nullptr;
+
+    if (!BuildBalancedSubtree(left_count, next_node, left_subtree_root))
+    {
+        return false;
+    }
+
+    NodeAVL<T>* node = next_node();
+
+    if (node == nullptr)
+    {
+        if (left_subtree_root != nullptr)
+        {
+            FreeMemoryForSetAVL(left_subtree_root);
+        }
+
+        return false;
+    }
+
+    node->SetLeft(left_subtree_root);
+
+    if (left_subtree_root != nullptr)
+    {
+        left_subtree_root->SetParent(node);
+    }
+
+    NodeAVL<T>* right_subtree_root = nullptr;
+
+    if (!BuildBalancedSubtree(count - left_count - 1, next_node, right_subtree_root))
+    {
+        FreeMemoryForSetAVL(node);
+        return false;
+    }
+
+    node->SetRight(right_subtree_root);
+
+    if (right_subtree_root != nullptr)
+    {
+        right_subtree_root->SetParent(node);
+    }
+
+    // 두 subtree의 node 개수 차이가 1 이하이므로 height 차이도 1 이하
+    UpdateHeight(node);
+    node->SetSize(count);
+    AugmentationTraits::Update(node);
+    out_root = node;
+
+    return true;
+}
+
+// 해당 node의 height를 재설정
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::UpdateHeight(NodeAVL<T>* node)
+{
+    // left subtree의 height
+    int left_subtree_height = -1;
+
+    // right subtree의 height
+    int right_subtree_height = -1;
+
+    if (node->GetLeft() != nullptr)
+    {
+        left_subtree_height = node->GetLeft()->GetHeight();
+    }
+
+    if (node->GetRight() != nullptr)
+    {
+        right_subtree_height = node->GetRight()->GetHeight();
+    }
+
+    if ((left_subtree_height == -1)
+        && (right_subtree_height == -1))
+    {
+        // left subtree와 right subtree 모두 empty tree인 경우
+        // parameter로 들어온 node는 leaf 노드
+        // leaf 노드의 height는 0으로 정의
+        node->SetHeight(0);
+    }
+    else
+    {
+        // left subtree와 right subtree 중 적어도 하나는 empty tree가 아닌 경우
+        node->SetHeight(
+            std::max(left_subtree_height, right_subtree_height) + 1);
+    }
+}
+
+// 해당 node의 size를 재설정
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::UpdateSize(NodeAVL<T>* node)
+{
+    int left_subtree_size = 0;
+    int right_subtree_size = 0;
+
+    if (node->GetLeft() != nullptr)
+    {
+        left_subtree_size = node->GetLeft()->GetSize();
+    }
+
+    if (node->GetRight() != nullptr)
+    {
+        right_subtree_size = node->GetRight()->GetSize();
+    }
+
+    node->SetSize(left_subtree_size + right_subtree_size + 1);
+    AugmentationTraits::Update(node);
+}
+
+// 해당 node의 (left subtree의 height) - (right subtree의 height)의 값을 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::GetBalanceFactor(NodeAVL<T>* node) const
+{
+    int left_subtree_height = -1;
+    int right_subtree_height = -1;
+
+    if (node->GetLeft() != nullptr)
+    {
+        left_subtree_height = node->GetLeft()->GetHeight();
+    }
+
+    if (node->GetRight() != nullptr)
+    {
+        right_subtree_height = node->GetRight()->GetHeight();
+    }
+
+    return left_subtree_height - right_subtree_height;
+}
+
+// 해당 node의 depth를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::GetDepth(NodeAVL<T>* node)
+{
+    // root node의 depth를 0으로 정의
+    int depth = 0;
+    NodeAVL<T>* current_node = node;
+
+    while (1)
+    {
+        if (current_node == root_)
+        {
+            return depth;
+        }
+        else
+        {
+            current_node = current_node->GetParent();
+            depth++;
+        }
+    }
+}
+
+// start_node부터 root node까지 size, height를 갱신하면서 balance factor를 계산함
+// balance factor의 절댓값이 2 이상인 경우 Restructuring을 진행
+// Insert, Erase 모두 root node까지 한 번만 올라감
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::Restructuring(NodeAVL<T>* start_node)
+{
+    NodeAVL<T>* grand_parent_node = start_node;
+
+    while (1)
+    {
+        if (grand_parent_node == nullptr)
+        {
+            break;
+        }
+        else
+        {
+            // 자식의 size, height는 이미 갱신되어 있음
+            UpdateSize(grand_parent_node);
+            UpdateHeight(grand_parent_node);
+
+            if (std::abs(GetBalanceFactor(grand_parent_node)) >= 2)
+            {
+                // Restructuring 진행 후 grand_parent_node 재설정
+                grand_parent_node = RestructuringSubtree(grand_parent_node)->GetParent();
+            }
+            else
+            {
+                grand_parent_node = grand_parent_node->GetParent();
+            }
+        }
+    }
+}
+
+// balance factor의 절댓값이 2인 grand_parent_node에서 rotation을 진행하고
+// subtree의 새로운 root node를 return (자식의 height는 정확해야 함)
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::RestructuringSubtree(NodeAVL<T>* grand_parent_node)
+{
+    NodeAVL<T>* parent_node = nullptr;
+    NodeAVL<T>* child_node = nullptr;
+
+    if (GetBalanceFactor(grand_parent_node) >= 2)
+    {
+        // grand_parent_node의 left subtree의 height가 더 높음
+        parent_node = grand_parent_node->GetLeft();
+
+        if (GetBalanceFactor(parent_node) >= 0)
+        {
+            // parent_node의 left subtree의 height가 더 높음
+            child_node = parent_node->GetLeft();
+            RestructuringForLeftLeftCase(child_node, parent_node, grand_parent_node);
+
+            return parent_node;
+        }
+
+        // parent_node의 right subtree의 height가 더 높음
+        child_node = parent_node->GetRight();
+        RestructuringForLeftRightCase(child_node, parent_node, grand_parent_node);
+
+        return child_node;
+    }
+
+    // grand_parent_node의 right subtree의 height가 더 높음
+    parent_node = grand_parent_node->GetRight();
+
+    if (GetBalanceFactor(parent_node) > 0)
+    {
+        // parent_node의 left subtree의 height가 더 높음
+        child_node = parent_node->GetLeft();
+        RestructuringForRightLeftCase(child_node, parent_node, grand_parent_node);
+
+        return child_node;
+    }
+
+    // parent_node의 right subtree의 height가 더 높음
+    child_node = parent_node->GetRight();
+    RestructuringForRightRightCase(child_node, parent_node, grand_parent_node);
+
+    return parent_node;
+}
+
+// 새로 연결한 leaf node의 parent부터 BalancePolicy에 따라 rebalancing 진행
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RebalanceAfterInsert(NodeAVL<T>* node)
+{
+    if (relaxed_balance_)
+    {
+        MarkImbalance(node->GetParent());
+        RebalancePending(rebalance_budget_);
+    }
+    else if (BalancePolicy::kRankBalanced)
+    {
+        UpdateSizeToRoot(node->GetParent());
+        RebalanceRankAfterInsert(node);
+    }
+    else
+    {
+        Restructuring(node->GetParent());
+    }
+}
+
+// node를 떼어낸 자리의 parent_node부터 BalancePolicy에 따라 rebalancing 진행
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RebalanceAfterErase(NodeAVL<T>* parent_node)
+{
+    if (relaxed_balance_)
+    {
+        MarkImbalance(parent_node);
+        RebalancePending(rebalance_budget_);
+    }
+    else if (BalancePolicy::kRankBalanced)
+    {
+        // rotation은 자식의 size로 자신의 size를 계산하므로 size를 먼저 갱신함
+        UpdateSizeToRoot(parent_node);
+        RebalanceRankAfterErase(parent_node);
+    }
+    else
+    {
+        Restructuring(parent_node);
+    }
+}
+
+// relaxed balance를 켜거나 끔 (끄면 기록된 node를 모두 rebalancing함)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::SetRelaxedBalance(bool enabled, int budget_per_operation)
+{
+    static_assert(!BalancePolicy::kRankBalanced,
+        "relaxed balance requires AVLBalancePolicy");
+
+    relaxed_balance_ = enabled;
+    rebalance_budget_ = budget_per_operation;
+
+    if (!enabled)
+    {
+        RebalancePending(INT_MAX);
+    }
+}
+
+// 기록된 node를 최대 budget개 rebalancing하고 남은 node의 개수를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+int SetAVL<T, BalancePolicy, Augmentation>::RebalancePending(int budget)
+{
+    while ((budget > 0) && !pending_nodes_.empty())
+    {
+        NodeAVL<T>* node = *pending_nodes_.begin();
+        pending_nodes_.erase(pending_nodes_.begin());
+
+        RebalancePendingNode(node);
+        budget--;
+    }
+
+    return static_cast<int>(pending_nodes_.size());
+}
+
+// membership filter를 켜거나 끔
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::SetMembershipFilter(bool enabled, int bits_per_key)
+{
+    static_assert(std::is_default_constructible<std::hash<T>>::value,
+        "membership filter requires std::hash<T>");
+
+    filter_enabled_ = enabled;
+    filter_bits_per_key_ = bits_per_key;
+
+    if (enabled)
+    {
+        RebuildMembershipFilter();
+    }
+    else
+    {
+        filter_ = BlockedBloomFilter<T>();
+    }
+}
+
+// hash index를 켜거나 끔
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::SetHashIndex(bool enabled)
+{
+    static_assert(std::is_default_constructible<std::hash<T>>::value,
+        "hash index requires std::hash<T>");
+
+    hash_index_enabled_ = enabled;
+
+    if (enabled)
+    {
+        RebuildHashIndex();
+    }
+    else
+    {
+        hash_index_ = NodeHashIndex<T>();
+    }
+}
+
+// hot key cache를 켜거나 끔
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::SetHotKeyCache(bool enabled, int slot_count)
+{
+    static_assert(std::is_default_constructible<std::hash<T>>::value,
+        "hot key cache requires std::hash<T>");
+
+    hot_key_cache_enabled_ = enabled;
+    hot_key_cache_ = HotKeyCache<T>();
+
+    if (enabled)
+    {
+        hot_key_cache_.Reset(slot_count);
+    }
+}
+
+// [lo, hi]에 들어있는 key를 오름차순으로 Combine한 값을 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+typename SetAVL<T, BalancePolicy, Augmentation>::AggregateValue
+SetAVL<T, BalancePolicy, Augmentation>::Aggregate(const T& lo, const T& hi) const
+{
+    static_assert(AugmentationTraits::kEnabled, "Aggregate requires an augmentation");
+
+    // lo와 hi 사이로 처음 들어오는 node(split node)를 찾음
+    // 그 아래에서 lo 쪽 경계는 left subtree에, hi 쪽 경계는 right subtree에만 있음
+    NodeAVL<T>* split_node = root_;
+
+    while (split_node != nullptr && (split_node->GetKey() < lo || hi < split_node->GetKey()))
+    {
+        split_node = (split_node->GetKey() < lo) ? split_node->GetRight() : split_node->GetLeft();
+    }
+
+    if (split_node == nullptr)
+    {
+        return Augmentation::Identity();
+    }
+
+    // left subtree에서 lo 이상인 key: lo 이상인 node를 만나면 그 node와 right subtree가
+    // 지금까지 모은 값보다 앞에 오므로 앞쪽에 합치고 left로 내려감
+    AggregateValue lower_part = Augmentation::Identity();
+
+    for (NodeAVL<T>* node = split_node->GetLeft(); node != nullptr;)
+    {
+        if (node->GetKey() < lo)
+        {
+            node = node->GetRight();
+            continue;
+        }
+
+        lower_part = Augmentation::Combine(
+            Augmentation::Combine(Augmentation::FromKey(node->GetKey()), AugmentationTraits::Get(node->GetRight())),
+            lower_part);
+        node = node->GetLeft();
+    }
+
+    // right subtree에서 hi 이하인 key: 위와 대칭으로 뒤쪽에 합치고 right로 내려감
+    AggregateValue upper_part = Augmentation::Identity();
+
+    for (NodeAVL<T>* node = split_node->GetRight(); node != nullptr;)
+    {
+        if (hi < node->GetKey())
+        {
+            node = node->GetLeft();
+            continue;
+        }
+
+        upper_part = Augmentation::Combine(
+            upper_part,
+            Augmentation::Combine(AugmentationTraits::Get(node->GetLeft()), Augmentation::FromKey(node->GetKey())));
+        node = node->GetRight();
+    }
+
+    return Augmentation::Combine(
+        Augmentation::Combine(lower_part, Augmentation::FromKey(split_node->GetKey())), upper_part);
+}
+
+// hot_key_cache_를 통해 key를 가진 node의 depth와 rank를 구함
+template <typename T, typename BalancePolicy, typename Augmentation>
+bool SetAVL<T, BalancePolicy, Augmentation>::FindWithHotKeyCache(const T& key, int& out_depth, int* out_rank)
+{
+    typename HotKeyCache<T>::Entry* entry = hot_key_cache_.Lookup(key, structure_version_);
+
+    if (entry != nullptr)
+    {
+        // 저장한 뒤 tree 모양이 바뀌었으면 node에서 root까지 올라가며 depth를 다시 셈
+        if (entry->version != structure_version_)
+        {
+            entry->depth = GetDepth(entry->node);
+            entry->rank = 0;
+            entry->version = structure_version_;
+        }
+
+        if (out_rank != nullptr && entry->rank == 0)
+        {
+            GetDepthAndRank(entry->node, entry->depth, entry->rank);
+        }
+
+        out_depth = entry->depth;
+
+        if (out_rank != nullptr)
+        {
+            *out_rank = entry->rank;
+        }
+
+        return true;
+    }
+
+    if (filter_enabled_ && !filter_.MayContain(key))
+    {
+        return false;
+    }
+
+    NodeAVL<T>* node = nullptr;
+    int depth = 0;
+
+    if (hash_index_enabled_)
+    {
+        node = hash_index_.Find(key);
+        depth = (node == nullptr) ? 0 : GetDepth(node);
+    }
+    else
+    {
+        node = root_;
+
+        while (node != nullptr && !(key == node->GetKey()))
+        {
+            node = (key < node->GetKey()) ? node->GetLeft() : node->GetRight();
+            depth++;
+        }
+    }
+
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    int rank = 0;
+
+    if (out_rank != nullptr)
+    {
+        GetDepthAndRank(node, depth, rank);
+        *out_rank = rank;
+    }
+
+    out_depth = depth;
+    hot_key_cache_.Store(node, depth, rank, structure_version_);
+
+    return true;
+}
+
+// node에서 root까지 parent를 따라 올라가며 depth와 rank를 계산
+// rank는 node의 left subtree와, node가 right subtree에 있는 조상마다 그 조상과 left subtree를 더함
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::GetDepthAndRank(
+    const NodeAVL<T>* node, int& out_depth, int& out_rank) const
+{
+    int depth = 0;
+    int rank = ((node->GetLeft() != nullptr) ? node->GetLeft()->GetSize() : 0) + 1;
+
+    for (const NodeAVL<T>* current = node; current->GetParent() != nullptr; current = current->GetParent())
+    {
+        const NodeAVL<T>* parent_node = current->GetParent();
+
+        if (parent_node->GetRight() == current)
+        {
+            rank += ((parent_node->GetLeft() != nullptr) ? parent_node->GetLeft()->GetSize() : 0) + 1;
+        }
+
+        depth++;
+    }
+
+    out_depth = depth;
+    out_rank = rank;
+}
+
+// 현재 node로 hash_index_를 다시 만듦
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RebuildHashIndex()
+{
+    hash_index_.Reset(size_);
+
+    for (NodeAVL<T>* node = leftmost_; node != nullptr; node = GetNextNodeInOrder(node))
+    {
+        hash_index_.Insert(node);
+    }
+}
+
+// 현재 원소로 filter_를 다시 만듦
+// 원소 개수의 2배를 담을 수 있게 만들므로 다시 만드는 O(n)은 삽입 또는 삭제 n / 2번마다 한 번
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RebuildMembershipFilter()
+{
+    filter_.Reset(std::max(2 * size_, kMinFilterCapacity), filter_bits_per_key_);
+
+    for (NodeAVL<T>* node = leftmost_; node != nullptr; node = GetNextNodeInOrder(node))
+    {
+        filter_.Add(node->GetKey());
+    }
+}
+
+// relaxed balance에서 start_node부터 root node까지 size, height를 갱신하고
+// balance factor의 절댓값이 2 이상인 node를 기록
+// height가 항상 정확하므로 기록되지 않은 node는 모두 balance factor가 -1, 0, 1임
+// 이미 기울어져 있던 node는 기록되어 있으므로 새로 기울어진 node만 기록함
+// (올라가는 동안 height가 바뀌는 자식은 바로 아래 node뿐이므로 그 변화로 이전 balance factor를 구함)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::MarkImbalance(NodeAVL<T>* start_node)
+{
+    NodeAVL<T>* child_node = nullptr;
+    int child_height_change = 0;
+
+    for (NodeAVL<T>* node = start_node; node != nullptr; node = node->GetParent())
+    {
+        const int height = node->GetHeight();
+
+        UpdateSize(node);
+        UpdateHeight(node);
+
+        const int balance_factor = GetBalanceFactor(node);
+
+        if (std::abs(balance_factor) >= 2)
+        {
+            // start_node는 자식이 연결되거나 떼어졌으므로 항상 기록함
+            int previous_balance_factor = balance_factor;
+
+            if (child_node != nullptr)
+            {
+                previous_balance_factor += (node->GetLeft() == child_node)
+                    ? -child_height_change : child_height_change;
+            }
+
+            if ((child_node == nullptr) || (std::abs(previous_balance_factor) < 2))
+            {
+                pending_nodes_.insert(node);
+            }
+        }
+
+        child_node = node;
+        child_height_change = node->GetHeight() - height;
+    }
+}
+
+// 기록된 node 하나를 rebalancing
+// rotation으로 올라갈 자식이나 손자가 기울어져 있으면 그 node를 먼저 rebalancing하여
+// 대부분의 경우 한 번의 Restructuring으로 끝나도록 함
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RebalancePendingNode(NodeAVL<T>* node)
+{
+    // rotation이나 subtree 재구성으로 depth가 바뀜
+    structure_version_++;
+
+    while (1)
+    {
+        const int balance_factor = GetBalanceFactor(node);
+
+        if (std::abs(balance_factor) < 2)
+        {
+            // 다른 node를 rebalancing하면서 이미 균형이 맞춰짐
+            return;
+        }
+
+        if (std::abs(balance_factor) > 2)
+        {
+            // 한 번의 Restructuring으로 고칠 수 없을 만큼 기울어졌으면 subtree를 다시 구성함
+            FinishRebalancing(RebuildSubtree(node));
+            return;
+        }
+
+        // rotation으로 올라갈 node (Left Right, Right Left Case에서는 손자)
+        NodeAVL<T>* heavy_child = (balance_factor > 0) ? node->GetLeft() : node->GetRight();
+        const int heavy_child_balance_factor = GetBalanceFactor(heavy_child);
+        NodeAVL<T>* rising_node = heavy_child;
+
+        if (std::abs(heavy_child_balance_factor) <= 1)
+        {
+            if ((balance_factor > 0) && (heavy_child_balance_factor < 0))
+            {
+                rising_node = heavy_child->GetRight();
+            }
+            else if ((balance_factor < 0) && (heavy_child_balance_factor > 0))
+            {
+                rising_node = heavy_child->GetLeft();
+            }
+        }
+
+        if (std::abs(GetBalanceFactor(rising_node)) <= 1)
+        {
+            FinishRebalancing(RestructuringSubtree(node));
+            return;
+        }
+
+        // 기울어진 node는 기록되어 있으므로 기록을 지우고 먼저 rebalancing한 뒤 node를 다시 확인함
+        pending_nodes_.erase(rising_node);
+        RebalancePendingNode(rising_node);
     }
-    else
+}
+
+// rebalancing으로 subtree_root를 root로 하는 subtree의 height가 바뀌었을 수 있으므로
+// height가 바뀌지 않는 node를 만날 때까지 올라가며 다시 기록함 (size는 그대로)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::FinishRebalancing(NodeAVL<T>* subtree_root)
+{
+    for (NodeAVL<T>* node = subtree_root->GetParent(); node != nullptr; node = node->GetParent())
     {
-        // 삭제하려고 하는 노드의 자식이 1개인 경우
-        EraseNodeThatHasOnlyOneChild(erase_node);
-    }
+        const int height = node->GetHeight();
+        UpdateHeight(node);
 
-    // 원소의 개수 1 감소
-    size_--;
+        if (std::abs(GetBalanceFactor(node)) >= 2)
+        {
+            pending_nodes_.insert(node);
+        }
 
-    // 삭제한 노드의 depth를 return
-    return erase_node_depth;
+        if (node->GetHeight() == height)
+        {
+            break;
+        }
+    }
 }
 
-// 해당 node의 height를 재설정
-template <typename T>
-void SetAVL<T>::UpdateHeight(NodeAVL<T>* node)
+// node를 root로 하는 subtree의 node를 균형 잡힌 모양으로 다시 연결하고 새로운 root를 return
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::RebuildSubtree(NodeAVL<T>* node)
 {
-    // left subtree의 height
-    int left_subtree_height = -1;
+    NodeAVL<T>* parent_node = node->GetParent();
+    std::vector<NodeAVL<T>*> nodes;
+    nodes.reserve(node->GetSize());
+    PushDownSubtree(node);
 
-    // right subtree의 height
-    int right_subtree_height = -1;
+    // subtree의 node를 중위 순회 순서로 모음
+    NodeAVL<T>* current_node = GetLeftmostNode(node);
 
-    if (node->GetLeft() != nullptr)
+    for (int i = 0; i < node->GetSize(); i++)
     {
-        left_subtree_height = node->GetLeft()->GetHeight();
+        nodes.push_back(current_node);
+        current_node = GetNextNodeInOrder(current_node);
     }
 
-    if (node->GetRight() != nullptr)
+    // 다시 연결하면 모든 node의 balance factor가 -1, 0, 1이 됨
+    if (!pending_nodes_.empty())
     {
-        right_subtree_height = node->GetRight()->GetHeight();
+        for (NodeAVL<T>* subtree_node : nodes)
+        {
+            pending_nodes_.erase(subtree_node);
+        }
     }
 
-    if ((left_subtree_height == -1)
-        && (right_subtree_height == -1))
+    NodeAVL<T>* subtree_root = LinkBalancedSubtree(
+        nodes, 0, static_cast<int>(nodes.size()), parent_node);
+
+    if (parent_node == nullptr)
     {
-        // left subtree와 right subtree 모두 empty tree인 경우
-        // parameter로 들어온 node는 leaf 노드
-        // leaf 노드의 height는 0으로 정의
-        node->SetHeight(0);
+        root_ = subtree_root;
+    }
+    else if (parent_node->GetLeft() == node)
+    {
+        parent_node->SetLeft(subtree_root);
     }
     else
     {
-        // left subtree와 right subtree 중 적어도 하나는 empty tree가 아닌 경우
-        node->SetHeight(
-            std::max(left_subtree_height, right_subtree_height) + 1);
+        parent_node->SetRight(subtree_root);
     }
+
+    return subtree_root;
 }
 
-// start_node부터 root node까지 모든 node의 height 갱신
-template <typename T>
-void SetAVL<T>::UpdateHeightUntilRoot(NodeAVL<T>* start_node)
+// 오름차순인 nodes[begin, end)를 균형 잡힌 subtree로 연결하고 root를 return
+// BuildBalancedSubtree와 같이 각 node의 left subtree는 (end - begin) / 2개의 node를 가짐
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::LinkBalancedSubtree(
+    const std::vector<NodeAVL<T>*>& nodes, int begin, int end, NodeAVL<T>* parent_node)
 {
-    NodeAVL<T>* current_node = start_node;
-
-    if (current_node == nullptr)
+    if (begin >= end)
     {
-        return;
+        return nullptr;
     }
 
-    while (1)
-    {
-        // current_node의 height 재설정
-        UpdateHeight(current_node);
+    const int middle = begin + (end - begin) / 2;
+    NodeAVL<T>* node = nodes[middle];
 
-        if (current_node == root_)
-        {
-            // current_node가 root 노드이므로 더 이상 height를 갱신할 node가 없음
-            break;
-        }
-        else
-        {
-            // 부모 노드로 이동
-            current_node = current_node->GetParent();
-        }
-    }
+    node->SetParent(parent_node);
+    node->SetLeft(LinkBalancedSubtree(nodes, begin, middle, node));
+    node->SetRight(LinkBalancedSubtree(nodes, middle + 1, end, node));
+    UpdateHeight(node);
+    UpdateSize(node);
+
+    return node;
 }
 
-// 해당 node의 size를 재설정
-template <typename T>
-void SetAVL<T>::UpdateSize(NodeAVL<T>* node)
+// start_node부터 root node까지 size만 갱신
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::UpdateSizeToRoot(NodeAVL<T>* start_node)
 {
-    int left_subtree_size = 0;
-    int right_subtree_size = 0;
+    for (NodeAVL<T>* node = start_node; node != nullptr; node = node->GetParent())
+    {
+        UpdateSize(node);
+    }
+}
 
-    if (node->GetLeft() != nullptr)
+// root부터 node까지 내려가며 tag를 자식에게 내려보냄
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::PushDownPath(NodeAVL<T>* node)
+{
+    if (!AugmentationTraits::kLazy || node == nullptr)
     {
-        left_subtree_size = node->GetLeft()->GetSize();
+        return;
     }
 
-    if (node->GetRight() != nullptr)
+    std::vector<NodeAVL<T>*> path;
+
+    for (NodeAVL<T>* current_node = node; current_node != nullptr; current_node = current_node->GetParent())
     {
-        right_subtree_size = node->GetRight()->GetSize();
+        path.push_back(current_node);
     }
 
-    node->SetSize(left_subtree_size + right_subtree_size + 1);
+    for (auto it = path.rbegin(); it != path.rend(); ++it)
+    {
+        AugmentationTraits::PushDown(*it);
+    }
 }
 
-// start_node부터 root node까지 모든 node의 size 갱신
-template <typename T>
-void SetAVL<T>::UpdateSizeUntilRoot(NodeAVL<T>* start_node)
+// 전위 순회로 subtree의 모든 tag를 내려보냄
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::PushDownSubtree(NodeAVL<T>* node)
 {
-    NodeAVL<T>* current_node = start_node;
-
-    if (current_node == nullptr)
+    if (!AugmentationTraits::kLazy || node == nullptr)
     {
         return;
     }
 
-    while (1)
+    AugmentationTraits::PushDown(node);
+    PushDownSubtree(node->GetLeft());
+    PushDownSubtree(node->GetRight());
+}
+
+// WeakAVLBalancePolicy의 삽입 후 rebalancing
+// node와 parent_node의 rank가 같은 동안(rank 차이가 0) 아래를 반복함
+//   sibling의 rank 차이가 1이면 parent_node를 promote하고 위로 올라감
+//   sibling의 rank 차이가 2이면 single 또는 double rotation 후 종료
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RebalanceRankAfterInsert(NodeAVL<T>* node)
+{
+    NodeAVL<T>* parent_node = node->GetParent();
+
+    while ((parent_node != nullptr)
+        && (parent_node->GetHeight() == node->GetHeight()))
     {
-        // current_node의 height 재설정
-        UpdateSize(current_node);
+        bool is_left_child = (parent_node->GetLeft() == node);
+        NodeAVL<T>* sibling = is_left_child ? parent_node->GetRight() : parent_node->GetLeft();
 
-        if (current_node == root_)
+        if (parent_node->GetHeight() - GetRank(sibling) == 1)
         {
-            // current_node가 root 노드이므로 더 이상 size를 갱신할 node가 없음
-            break;
+            // parent_node를 promote하면 parent_node와 그 부모의 rank 차이가 0이 될 수 있음
+            parent_node->SetHeight(parent_node->GetHeight() + 1);
+            node = parent_node;
+            parent_node = node->GetParent();
+            continue;
+        }
+
+        // node는 promote된 node이므로 자식의 rank 차이가 1, 2
+        // parent_node 쪽을 향하는 안쪽 자식의 rank 차이에 따라 rotation 방법이 다름
+        NodeAVL<T>* inner_child = is_left_child ? node->GetRight() : node->GetLeft();
+
+        if (node->GetHeight() - GetRank(inner_child) == 2)
+        {
+            // single rotation: node가 올라가고 parent_node는 demote
+            RotateUp(node);
+            parent_node->SetHeight(parent_node->GetHeight() - 1);
         }
         else
         {
-            // 부모 노드로 이동
-            current_node = current_node->GetParent();
+            // double rotation: inner_child가 올라가서 promote, node와 parent_node는 demote
+            RotateUp(inner_child);
+            RotateUp(inner_child);
+            inner_child->SetHeight(inner_child->GetHeight() + 1);
+            node->SetHeight(node->GetHeight() - 1);
+            parent_node->SetHeight(parent_node->GetHeight() - 1);
         }
+
+        break;
     }
 }
 
-// 해당 node의 (left subtree의 height) - (right subtree의 height)의 값을 return
-template <typename T>
-int SetAVL<T>::GetBalanceFactor(NodeAVL<T>* node)
+// WeakAVLBalancePolicy의 삭제 후 rebalancing
+// node가 rank 1인 leaf이거나 rank 차이가 3인 자식을 가진 동안 아래를 반복함
+//   rank 1인 leaf이면 demote하고 위로 올라감
+//   sibling의 rank 차이가 2이면 node를 demote하고 위로 올라감
+//   sibling의 두 자식의 rank 차이가 모두 2이면 node와 sibling을 demote하고 위로 올라감
+//   그렇지 않으면 single 또는 double rotation 후 종료
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RebalanceRankAfterErase(NodeAVL<T>* node)
 {
-    int left_subtree_height = -1;
-    int right_subtree_height = -1;
-
-    if (node->GetLeft() != nullptr)
+    while (node != nullptr)
     {
-        left_subtree_height = node->GetLeft()->GetHeight();
-    }
+        const int rank = node->GetHeight();
+        NodeAVL<T>* left_child = node->GetLeft();
+        NodeAVL<T>* right_child = node->GetRight();
 
-    if (node->GetRight() != nullptr)
-    {
-        right_subtree_height = node->GetRight()->GetHeight();
-    }
+        if ((left_child == nullptr) && (right_child == nullptr) && (rank == 1))
+        {
+            // 자식의 rank 차이가 모두 2인 leaf
+            node->SetHeight(0);
+            node = node->GetParent();
+            continue;
+        }
 
-    return left_subtree_height - right_subtree_height;
-}
+        // rank 차이가 3인 자식의 sibling
+        NodeAVL<T>* sibling = nullptr;
 
-// 해당 node의 depth를 return
-template <typename T>
-int SetAVL<T>::GetDepth(NodeAVL<T>* node)
-{
-    // root node의 depth를 0으로 정의
-    int depth = 0;
-    NodeAVL<T>* current_node = node;
+        if (rank - GetRank(left_child) == 3)
+        {
+            sibling = right_child;
+        }
+        else if (rank - GetRank(right_child) == 3)
+        {
+            sibling = left_child;
+        }
+        else
+        {
+            break;
+        }
 
-    while (1)
-    {
-        if (current_node == root_)
+        // rank 차이가 3인 자식이 있으므로 sibling의 rank는 0 이상
+        const int sibling_rank = sibling->GetHeight();
+
+        if (rank - sibling_rank == 2)
         {
-            return depth;
+            node->SetHeight(rank - 1);
+            node = node->GetParent();
+            continue;
+        }
+
+        bool sibling_is_left = (sibling == left_child);
+        NodeAVL<T>* outer_child = sibling_is_left ? sibling->GetLeft() : sibling->GetRight();
+        NodeAVL<T>* inner_child = sibling_is_left ? sibling->GetRight() : sibling->GetLeft();
+
+        if ((sibling_rank - GetRank(outer_child) == 2)
+            && (sibling_rank - GetRank(inner_child) == 2))
+        {
+            node->SetHeight(rank - 1);
+            sibling->SetHeight(sibling_rank - 1);
+            node = node->GetParent();
+            continue;
+        }
+
+        if (sibling_rank - GetRank(outer_child) == 1)
+        {
+            // single rotation: sibling이 올라가서 promote, node는 demote
+            // node가 leaf가 되면 rank가 0이 되도록 한 번 더 demote
+            RotateUp(sibling);
+            sibling->SetHeight(sibling_rank + 1);
+            node->SetHeight(rank - 1);
+
+            if ((node->GetLeft() == nullptr) && (node->GetRight() == nullptr))
+            {
+                node->SetHeight(rank - 2);
+            }
         }
         else
         {
-            current_node = current_node->GetParent();
-            depth++;
+            // double rotation: inner_child가 올라가서 두 번 promote
+            // sibling은 한 번, node는 두 번 demote
+            RotateUp(inner_child);
+            RotateUp(inner_child);
+            inner_child->SetHeight(inner_child->GetHeight() + 2);
+            sibling->SetHeight(sibling_rank - 1);
+            node->SetHeight(rank - 2);
         }
+
+        break;
     }
 }
 
-// new_node부터 root node까지 balance factor를 계산함
-// balance factor의 절댓값이 2 이상인 경우 Restructuring을 진행
-template <typename T>
-void SetAVL<T>::Restructuring(NodeAVL<T>* new_node)
+// node를 parent 자리로 올리는 single rotation
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RotateUp(NodeAVL<T>* node)
 {
-    NodeAVL<T>* current_node = new_node;
-    NodeAVL<T>* parent_node = new_node->GetParent();
+    NodeAVL<T>* parent_node = node->GetParent();
     NodeAVL<T>* grand_parent_node = parent_node->GetParent();
 
-    if (grand_parent_node == nullptr)
+    // 두 node의 자식이 바뀌므로 tag를 먼저 내려보냄
+    AugmentationTraits::PushDown(parent_node);
+    AugmentationTraits::PushDown(node);
+
+    SET_AVL_PROBE3(rotation,
+        (parent_node->GetLeft() == node) ? kSetAVLRotationUpFromLeft : kSetAVLRotationUpFromRight,
+        SetAVLProbeKey(parent_node->GetKey()), parent_node->GetHeight());
+
+    // node의 안쪽 subtree는 parent_node로 옮겨감
+    NodeAVL<T>* moved_subtree = nullptr;
+
+    if (parent_node->GetLeft() == node)
     {
-        // grand parent node가 null일 경우 restructuring을 진행할 필요 없음
-        return;
+        moved_subtree = node->GetRight();
+        parent_node->SetLeft(moved_subtree);
+        node->SetRight(parent_node);
     }
     else
     {
-        while (1)
-        {
-            int balance_factor = GetBalanceFactor(grand_parent_node);
+        moved_subtree = node->GetLeft();
+        parent_node->SetRight(moved_subtree);
+        node->SetLeft(parent_node);
+    }
 
-            if (std::abs(balance_factor) <= 1)
-            {
-                // balance_factor의 절댓값이 1 이하인 경우 
-                // restructuring을 진행할 필요 없음
+    if (moved_subtree != nullptr)
+    {
+        moved_subtree->SetParent(parent_node);
+    }
 
-                if (grand_parent_node == root_)
-                {
-                    break;
-                }
-                else
-                {
-                    // current_node, parent_node, grand_parent_node 모두 자신의 부모 노드로 이동
-                    current_node = parent_node;
-                    parent_node = grand_parent_node;
-                    grand_parent_node = grand_parent_node->GetParent();
-                }
-            }
-            else
-            {
-                // balance_factor의 절댓값이 2 이상인 경우 
-                // restructuring이 필요함
-            
-                if (grand_parent_node->GetLeft() == parent_node)
-                {
-                    if (parent_node->GetLeft() == current_node)
-                    {
-                        /*
-                             z
-                            /
-                           y
-                          /
-                         x
-                        */
-                        RestructuringForLeftLeftCase(
-                            current_node, parent_node, grand_parent_node);
-                    }
-                    else
-                    {
-                        /*
-                            z
-                           /
-                          y
-                           \
-                            x
-                        */
-                        RestructuringForLeftRightCase(
-                            current_node, parent_node, grand_parent_node);
-                    }
-                }
-                else
-                {
-                    if (parent_node->GetLeft() == current_node)
-                    {
-                        /*
-                          z
-                           \
-                            y
-                           /
-                          x
-                        */
-                        RestructuringForRightLeftCase(
-                            current_node, parent_node, grand_parent_node);
-                    }
-                    else
-                    {
-                        /*
-                          z
-                           \
-                            y
-                             \
-                              x
-                        */
-                        RestructuringForRightRightCase(
-                            current_node, parent_node, grand_parent_node);
-                    }
-                }
-            }
-        }
+    node->SetParent(grand_parent_node);
+    parent_node->SetParent(node);
+
+    if (grand_parent_node == nullptr)
+    {
+        root_ = node;
+    }
+    else if (grand_parent_node->GetLeft() == parent_node)
+    {
+        grand_parent_node->SetLeft(node);
+    }
+    else
+    {
+        grand_parent_node->SetRight(node);
     }
+
+    // node의 subtree는 parent_node의 원래 subtree와 같음
+    node->SetSize(parent_node->GetSize());
+    UpdateSize(parent_node);
+    AugmentationTraits::Update(node);
+
+    rotation_count_++;
 }
 
 // Left Left Case에 대하여 restructuring 진행
-template <typename T>
-void SetAVL<T>::RestructuringForLeftLeftCase(
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RestructuringForLeftLeftCase(
     NodeAVL<T>* current_node, 
     NodeAVL<T>* parent_node,
     NodeAVL<T>* grand_parent_node)
@@ -712,6 +3070,16 @@ void SetAVL<T>::RestructuringForLeftLeftCase(
       /
      x
     */
+
+    // 세 node의 자식이 바뀌므로 tag를 먼저 내려보냄
+    AugmentationTraits::PushDown(grand_parent_node);
+    AugmentationTraits::PushDown(parent_node);
+    AugmentationTraits::PushDown(current_node);
+
+    rotation_count_ += 1;
+
+    SET_AVL_PROBE3(rotation, kSetAVLRotationLeftLeft,
+        SetAVLProbeKey(grand_parent_node->GetKey()), grand_parent_node->GetHeight());
     
     // grand_parent_node의 부모 노드(grand_grand_parent_node)가 있는지 확인
     if (grand_parent_node->GetParent() != nullptr)
@@ -776,14 +3144,18 @@ void SetAVL<T>::RestructuringForLeftLeftCase(
 
     grand_parent_node->SetSize(subtree_t3_root_size + subtree_t4_root_size + 1);
     parent_node->SetSize(current_node->GetSize() + grand_parent_node->GetSize() + 1);
+    AugmentationTraits::Update(grand_parent_node);
+    AugmentationTraits::Update(parent_node);
 
-    // grand_parent_node부터 root까지 height 재설정
-    UpdateHeightUntilRoot(grand_parent_node);
+    // grand_parent_node, parent_node의 height 재설정
+    // 그 위의 node는 Restructuring에서 올라가면서 갱신함
+    UpdateHeight(grand_parent_node);
+    UpdateHeight(parent_node);
 }
 
 // Left Right Case에 대하여 restructuring 진행
-template <typename T>
-void SetAVL<T>::RestructuringForLeftRightCase(
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RestructuringForLeftRightCase(
     NodeAVL<T>* current_node,
     NodeAVL<T>* parent_node,
     NodeAVL<T>* grand_parent_node)
@@ -796,6 +3168,16 @@ void SetAVL<T>::RestructuringForLeftRightCase(
          x
     */
 
+    // 세 node의 자식이 바뀌므로 tag를 먼저 내려보냄
+    AugmentationTraits::PushDown(grand_parent_node);
+    AugmentationTraits::PushDown(parent_node);
+    AugmentationTraits::PushDown(current_node);
+
+    rotation_count_ += 2;
+
+    SET_AVL_PROBE3(rotation, kSetAVLRotationLeftRight,
+        SetAVLProbeKey(grand_parent_node->GetKey()), grand_parent_node->GetHeight());
+
     // grand_parent_node의 부모 노드(grand_grand_parent_node)가 있는지 확인
     if (grand_parent_node->GetParent() != nullptr)
     {
@@ -853,8 +3235,9 @@ void SetAVL<T>::RestructuringForLeftRightCase(
     UpdateHeight(parent_node);
     UpdateHeight(grand_parent_node);
 
-    // current_node부터 root까지 height 재설정
-    UpdateHeightUntilRoot(current_node);
+    // current_node의 height 재설정
+    // 그 위의 node는 Restructuring에서 올라가면서 갱신함
+    UpdateHeight(current_node);
 
     // current_node, parent_node, grand_parent_node에 대한 size 재설정
     int subtree_t1_root_size = 0;
@@ -885,11 +3268,14 @@ void SetAVL<T>::RestructuringForLeftRightCase(
     grand_parent_node->SetSize(subtree_t3_root_size + subtree_t4_root_size + 1);
     parent_node->SetSize(subtree_t1_root_size + subtree_t2_root_size + 1);
     current_node->SetSize(parent_node->GetSize() + grand_parent_node->GetSize() + 1);
+    AugmentationTraits::Update(grand_parent_node);
+    AugmentationTraits::Update(parent_node);
+    AugmentationTraits::Update(current_node);
 }
 
 // Right Left Case에 대하여 restructuring 진행
-template <typename T>
-void SetAVL<T>::RestructuringForRightLeftCase(
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RestructuringForRightLeftCase(
     NodeAVL<T>* current_node,
     NodeAVL<T>* parent_node,
     NodeAVL<T>* grand_parent_node)
@@ -902,6 +3288,16 @@ void SetAVL<T>::RestructuringForRightLeftCase(
       x
     */
 
+    // 세 node의 자식이 바뀌므로 tag를 먼저 내려보냄
+    AugmentationTraits::PushDown(grand_parent_node);
+    AugmentationTraits::PushDown(parent_node);
+    AugmentationTraits::PushDown(current_node);
+
+    rotation_count_ += 2;
+
+    SET_AVL_PROBE3(rotation, kSetAVLRotationRightLeft,
+        SetAVLProbeKey(grand_parent_node->GetKey()), grand_parent_node->GetHeight());
+
     // grand_parent_node의 부모 노드(grand_grand_parent_node)가 있는지 확인
     if (grand_parent_node->GetParent() != nullptr)
     {
@@ -963,8 +3359,9 @@ void SetAVL<T>::RestructuringForRightLeftCase(
     UpdateHeight(parent_node);
     UpdateHeight(grand_parent_node);
 
-    // current_node부터 root까지 height 재설정
-    UpdateHeightUntilRoot(current_node);
+    // current_node의 height 재설정
+    // 그 위의 node는 Restructuring에서 올라가면서 갱신함
+    UpdateHeight(current_node);
 
     // current_node, parent_node, grand_parent_node에 대한 size 재설정
     int subtree_t1_root_size = 0;
@@ -995,11 +3392,14 @@ void SetAVL<T>::RestructuringForRightLeftCase(
     grand_parent_node->SetSize(subtree_t1_root_size + subtree_t2_root_size + 1);
     parent_node->SetSize(subtree_t3_root_size + subtree_t4_root_size + 1);
     current_node->SetSize(parent_node->GetSize() + grand_parent_node->GetSize() + 1);
+    AugmentationTraits::Update(grand_parent_node);
+    AugmentationTraits::Update(parent_node);
+    AugmentationTraits::Update(current_node);
 }
 
 // Right Right Case에 대하여 restructuring 진행
-template <typename T>
-void SetAVL<T>::RestructuringForRightRightCase(
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::RestructuringForRightRightCase(
     NodeAVL<T>* current_node,
     NodeAVL<T>* parent_node,
     NodeAVL<T>* grand_parent_node)
@@ -1012,6 +3412,16 @@ void SetAVL<T>::RestructuringForRightRightCase(
           x
     */
 
+    // 세 node의 자식이 바뀌므로 tag를 먼저 내려보냄
+    AugmentationTraits::PushDown(grand_parent_node);
+    AugmentationTraits::PushDown(parent_node);
+    AugmentationTraits::PushDown(current_node);
+
+    rotation_count_ += 1;
+
+    SET_AVL_PROBE3(rotation, kSetAVLRotationRightRight,
+        SetAVLProbeKey(grand_parent_node->GetKey()), grand_parent_node->GetHeight());
+
     // grand_parent_node의 부모 노드(grand_grand_parent_node)가 있는지 확인
     if (grand_parent_node->GetParent() != nullptr)
     {
@@ -1058,8 +3468,10 @@ void SetAVL<T>::RestructuringForRightRightCase(
         subtree_t2_root->SetParent(grand_parent_node);
     }
 
-    // grand_parent_node부터 root까지 height 재설정
-    UpdateHeightUntilRoot(grand_parent_node);
+    // grand_parent_node, parent_node의 height 재설정
+    // 그 위의 node는 Restructuring에서 올라가면서 갱신함
+    UpdateHeight(grand_parent_node);
+    UpdateHeight(parent_node);
 
     // current_node, parent_node, grand_parent_node에 대한 size 재설정
     // current_node의 경우 size의 변화가 없음
@@ -1078,15 +3490,17 @@ void SetAVL<T>::RestructuringForRightRightCase(
 
     grand_parent_node->SetSize(subtree_t1_root_size + subtree_t2_root_size + 1);
     parent_node->SetSize(current_node->GetSize() + grand_parent_node->GetSize() + 1);
+    AugmentationTraits::Update(grand_parent_node);
+    AugmentationTraits::Update(parent_node);
 }
 
-// node를 삭제 (node의 자식이 없는 경우)
-template <typename T>
-void SetAVL<T>::EraseNodeThatHasNoChild(NodeAVL<T>* node)
+// node를 tree에서 떼어냄 (node의 자식이 없는 경우)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::EraseNodeThatHasNoChild(NodeAVL<T>* node)
 {
     NodeAVL<T>* parent_of_node = node->GetParent();
       
-    // 해당 노드를 삭제함
+    // 해당 노드를 떼어냄
     if (parent_of_node != nullptr)
     {
         if (parent_of_node->GetLeft() == node)
@@ -1104,22 +3518,13 @@ void SetAVL<T>::EraseNodeThatHasNoChild(NodeAVL<T>* node)
         root_ = nullptr;
     }
 
-    // 삭제하려고 하는 노드에 대한 메모리 해제
-    delete node;
-
-    // parent_of_erase_node부터 루트 노드까지 height 갱신
-    UpdateHeightUntilRoot(parent_of_node);
-
-    // parent_of_node부터 root node까지 모든 node의 size 갱신
-    UpdateSizeUntilRoot(parent_of_node);
-
-    // 필요에 따라 Restructuring 진행
-    RestructuringForErase(parent_of_node);
+    // parent_of_node부터 root node까지 size, height를 갱신하고 필요에 따라 rebalancing 진행
+    RebalanceAfterErase(parent_of_node);
 }
 
-// node를 삭제 (node의 자식이 1개만 있는 경우)
-template <typename T>
-void SetAVL<T>::EraseNodeThatHasOnlyOneChild(NodeAVL<T>* node)
+// node를 tree에서 떼어냄 (node의 자식이 1개만 있는 경우)
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::EraseNodeThatHasOnlyOneChild(NodeAVL<T>* node)
 {
     NodeAVL<T>* parent_of_node = node->GetParent();
 
@@ -1174,62 +3579,72 @@ void SetAVL<T>::EraseNodeThatHasOnlyOneChild(NodeAVL<T>* node)
         child_of_node->SetParent(parent_of_node);
     }
 
-    // parent_of_erase_node부터 루트 노드까지 height 갱신
-    UpdateHeightUntilRoot(parent_of_node);
-
-    // parent_of_node부터 root node까지 모든 node의 size 갱신
-    UpdateSizeUntilRoot(parent_of_node);
-
-    // 필요에 따라 Restructuring 진행
-    RestructuringForErase(parent_of_node);
-
-    delete node;
+    // parent_of_node부터 root node까지 size, height를 갱신하고 필요에 따라 rebalancing 진행
+    RebalanceAfterErase(parent_of_node);
 }
 
 // node를 삭제 (node의 자식이 2개 있는 경우)
-template <typename T>
-void SetAVL<T>::EraseNodeThatHasTwoChildren(NodeAVL<T>* node)
+// key를 복사하지 않고 successor node를 node의 자리로 옮겨서 연결하므로
+// 다른 node는 모두 자신의 key와 메모리 위치를 그대로 유지함
+template <typename T, typename BalancePolicy, typename Augmentation>
+void SetAVL<T, BalancePolicy, Augmentation>::EraseNodeThatHasTwoChildren(NodeAVL<T>* node)
 {
     NodeAVL<T>* successor = FindSuccessor(node);
 
-    // successor의 부모 노드 저장
-    NodeAVL<T>* parent_of_successor = successor->GetParent();
+    // Restructuring을 시작할 node
+    NodeAVL<T>* restructuring_start_node = successor;
 
-    // node에 있는 key 값을 successor에 있는 key값으로 대체
-    node->SetKey(successor->GetKey());
-
-    // successor를 삭제
-    // successor의 parent 노드가 없는 경우는 존재하지 않음
-    // successor의 parent 노드와 successor의 right child를 연결함
-    if (parent_of_successor->GetLeft() == successor)
+    if (successor != node->GetRight())
     {
+        // successor는 node의 right subtree 안쪽에 있음
+        // successor의 parent 노드와 successor의 right child를 연결함
+        NodeAVL<T>* parent_of_successor = successor->GetParent();
         parent_of_successor->SetLeft(successor->GetRight());
+
+        if (successor->GetRight() != nullptr)
+        {
+            successor->GetRight()->SetParent(parent_of_successor);
+        }
+
+        // successor가 node의 right subtree를 이어받음
+        successor->SetRight(node->GetRight());
+        node->GetRight()->SetParent(successor);
+
+        restructuring_start_node = parent_of_successor;
     }
-    else
+
+    // successor가 node의 left subtree를 이어받음
+    successor->SetLeft(node->GetLeft());
+    node->GetLeft()->SetParent(successor);
+
+    // successor가 node의 rank를 이어받음 (AVLBalancePolicy는 Restructuring에서 다시 계산함)
+    successor->SetHeight(node->GetHeight());
+
+    // successor를 node의 parent와 연결함
+    NodeAVL<T>* parent_of_node = node->GetParent();
+    successor->SetParent(parent_of_node);
+
+    if (parent_of_node == nullptr)
     {
-        parent_of_successor->SetRight(successor->GetRight());
+        root_ = successor;
     }
-
-    if (successor->GetRight() != nullptr)
+    else if (parent_of_node->GetLeft() == node)
     {
-        successor->GetRight()->SetParent(parent_of_successor);
+        parent_of_node->SetLeft(successor);
+    }
+    else
+    {
+        parent_of_node->SetRight(successor);
     }
-    
-    delete successor;
-
-    // parent_of_successor부터 루트 노드까지 height 갱신
-    UpdateHeightUntilRoot(parent_of_successor);
-
-    // parent_of_successor부터 root node까지 모든 node의 size 갱신
-    UpdateSizeUntilRoot(parent_of_successor);
 
-    // 필요에 따라 Restructuring을 진행
-    RestructuringForErase(parent_of_successor);
+    // restructuring_start_node부터 root node까지 size, height를 갱신하고
+    // 필요에 따라 rebalancing 진행 (successor의 size, height도 여기서 갱신됨)
+    RebalanceAfterErase(restructuring_start_node);
 }
 
 // node의 successor를 찾음
-template <typename T>
-NodeAVL<T>* SetAVL<T>::FindSuccessor(NodeAVL<T>* node)
+template <typename T, typename BalancePolicy, typename Augmentation>
+NodeAVL<T>* SetAVL<T, BalancePolicy, Augmentation>::FindSuccessor(NodeAVL<T>* node)
 {
     if (node->GetRight() == nullptr)
     {
@@ -1250,100 +3665,3 @@ NodeAVL<T>* SetAVL<T>::FindSuccessor(NodeAVL<T>* node)
     }
 }
 
-// Erase 기능을 수행할 때 필요에 따라 Restructuring을 진행함
-template <typename T>
-void SetAVL<T>::RestructuringForErase(NodeAVL<T>* node)
-{
-    // root node까지 balance factor를 계산함
-    // balance factor의 절댓값이 2 이상인 경우 Restructuring을 진행
-
-    NodeAVL<T>* grand_parent_node = node;
-
-    while (1)
-    {
-        if (grand_parent_node == nullptr)
-        {
-            break;
-        }
-        else
-        {
-            int balance_factor_of_grand_parent_node = GetBalanceFactor(grand_parent_node);
-
-            if (std::abs(balance_factor_of_grand_parent_node) >= 2)
-            {
-                // Restructuring 필요
-                NodeAVL<T>* parent_node = nullptr;
-                NodeAVL<T>* child_node = nullptr;
-
-                if (balance_factor_of_grand_parent_node >= 2)
-                {
-                    // grand_parent_node의 left subtree의 height가 더 높음
-                    parent_node = grand_parent_node->GetLeft();
-
-                    int balance_factor_of_parent_node = GetBalanceFactor(parent_node);
-
-                    if (balance_factor_of_parent_node >= 0)
-                    {
-                        // parent_node의 left subtree의 height가 더 높음
-                        child_node = parent_node->GetLeft();
-
-                        // Restructuring 진행
-                        RestructuringForLeftLeftCase(
-                            child_node, parent_node, grand_parent_node);
-
-                        // grand_parent_node 재설정
-                        grand_parent_node = parent_node->GetParent();
-                    }
-                    else
-                    {
-                        // parent_node의 right subtree의 height가 더 높음
-                        child_node = parent_node->GetRight();
-
-                        // Restructuring 진행
-                        RestructuringForLeftRightCase(
-                            child_node, parent_node, grand_parent_node);
-
-                        // grand_parent_node 재설정
-                        grand_parent_node = child_node->GetParent();
-                    }
-                }
-                else
-                {
-                    // grand_parent_node의 right subtree의 height가 더 높음
-                    parent_node = grand_parent_node->GetRight();
-
-                    int balance_factor_of_parent_node = GetBalanceFactor(parent_node);
-
-                    if (balance_factor_of_parent_node > 0)
-                    {
-                        // parent_node의 left subtree의 height가 더 높음
-                        child_node = parent_node->GetLeft();
-
-                        // Restructuring 진행
-                        RestructuringForRightLeftCase(
-                            child_node, parent_node, grand_parent_node);
-
-                        // grand_parent_node 재설정
-                        grand_parent_node = child_node->GetParent();
-                    }
-                    else
-                    {
-                        // parent_node의 right subtree의 height가 더 높음
-                        child_node = parent_node->GetRight();
-
-                        // Restructuring 진행
-                        RestructuringForRightRightCase(
-                            child_node, parent_node, grand_parent_node);
-
-                        // grand_parent_node 재설정
-                        grand_parent_node = parent_node->GetParent();
-                    }
-                }
-            }
-            else
-            {
-                grand_parent_node = grand_parent_node->GetParent();
-            }
-        }
-    }
-}
@@ -0,0 +1,142 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_AVL_AUGMENTATION_H
+#define SET_AVL_AUGMENTATION_H
+
+#include "node_avl.h"
+
+#include <new>
+
+// SetAVL의 각 node에 subtree 전체에 대한 값(aggregate)을 저장하는 augmentation
+// Augmentation은 결합법칙을 만족하는 연산(monoid)을 아래와 같이 정의함
+//     typedef ... Value;                                       aggregate의 type
+//     static Value Identity();                                 빈 subtree의 aggregate
+//     static Value FromKey(const T& key);                      key 하나의 aggregate
+//     static Value Combine(const Value& left, const Value& right);   key 순서대로 두 aggregate를 합침
+// 교환법칙은 필요하지 않으며 Combine은 항상 작은 key 쪽을 left로 받음
+
+// augmentation을 사용하지 않음 (NodeAVL을 그대로 사용하고 aggregate를 갱신하는 코드가 모두 사라짐)
+struct SetAVLNoAugmentation
+{
+};
+
+// subtree의 key의 합
+template <typename T>
+struct SetAVLSumAugmentation
+{
+    typedef long long Value;
+
+    static Value Identity() { return 0; }
+    static Value FromKey(const T& key) { return static_cast<Value>(key); }
+    static Value Combine(const Value& left, const Value& right) { return left + right; }
+};
+
+// subtree에서 Predicate를 만족하는 key의 개수
+template <typename T, typename Predicate>
+struct SetAVLCountIfAugmentation
+{
+    typedef int Value;
+
+    static Value Identity() { return 0; }
+    static Value FromKey(const T& key) { return Predicate()(key) ? 1 : 0; }
+    static Value Combine(const Value& left, const Value& right) { return left + right; }
+};
+
+// aggregate를 함께 저장하는 node
+template <typename T, typename Augmentation>
+class AugmentedNodeAVL : public NodeAVL<T>
+{
+public:
+    typedef typename Augmentation::Value Value;
+
+    AugmentedNodeAVL(T key) : NodeAVL<T>(key), aggregate_(Augmentation::FromKey(key)) {}
+    void SetAggregate(const Value& aggregate) { aggregate_ = aggregate; }
+    const Value& GetAggregate() const { return aggregate_; }
+private:
+    // 해당 node를 루트 노드로 하는 subtree의 모든 key를 Combine한 값
+    Value aggregate_;
+};
+
+// SetAVL이 Augmentation에 따라 사용하는 node의 type과 node를 만들고 aggregate를 갱신하는 방법
+// Create: key만 가진 node를 new로 할당 (만들 수 없는 node type이면 nullptr)
+// Clone: source와 같은 key와 aggregate를 가진 node를 new로 할당 (Set을 복사할 때 사용)
+// Relocate: memory에 source의 key와 aggregate를 옮긴 node를 생성 (Compact 등에서 node를 옮길 때 사용)
+// link, height, size는 두 함수 모두 복사하지 않음
+// kStoresValue가 true이면 node에 key 외의 value가 있으므로 모든 node를 key로 새로 만드는 기능
+// (AssignSorted, LoadSnapshot)을 사용할 수 없음
+// kLazy가 true이면 node에 subtree 전체에 대해 미뤄둔 연산(tag)이 있으며, SetAVL은 tree 모양을 바꾸기 전에
+// PushDown으로 바뀌는 node의 tag를 자식에게 내려보냄 (Update는 tag가 남아있어도 맞는 값을 계산해야 함)
+template <typename T, typename Augmentation>
+struct SetAVLAugmentationTraits
+{
+    typedef AugmentedNodeAVL<T, Augmentation> Node;
+    typedef typename Augmentation::Value Value;
+
+    static constexpr bool kEnabled = true;
+    static constexpr bool kLazy = false;
+    static constexpr bool kStoresValue = false;
+
+    // node를 루트 노드로 하는 subtree의 aggregate (빈 subtree이면 Identity)
+    static Value Get(const NodeAVL<T>* node)
+    {
+        return (node == nullptr) ? Augmentation::Identity() : static_cast<const Node*>(node)->GetAggregate();
+    }
+
+    // 두 child의 aggregate가 맞다고 가정하고 node의 aggregate를 다시 계산
+    static void Update(NodeAVL<T>* node)
+    {
+        static_cast<Node*>(node)->SetAggregate(Augmentation::Combine(
+            Augmentation::Combine(Get(node->GetLeft()), Augmentation::FromKey(node->GetKey())),
+            Get(node->GetRight())));
+    }
+
+    static Node* Create(const T& key) { return new Node(key); }
+
+    static void PushDown(NodeAVL<T>*) {}
+
+    static Node* Clone(const NodeAVL<T>* source)
+    {
+        Node* node = new Node(source->GetKey());
+        node->SetAggregate(static_cast<const Node*>(source)->GetAggregate());
+
+        return node;
+    }
+
+    static Node* Relocate(void* memory, NodeAVL<T>* source)
+    {
+        Node* node = new (memory) Node(source->GetKey());
+        node->SetAggregate(static_cast<const Node*>(source)->GetAggregate());
+
+        return node;
+    }
+};
+
+template <typename T>
+struct SetAVLAugmentationTraits<T, SetAVLNoAugmentation>
+{
+    typedef NodeAVL<T> Node;
+
+    // SetAVL::Aggregate의 선언에만 사용됨
+    typedef SetAVLNoAugmentation Value;
+
+    static constexpr bool kEnabled = false;
+    static constexpr bool kLazy = false;
+    static constexpr bool kStoresValue = false;
+
+    static void Update(NodeAVL<T>*) {}
+    static void PushDown(NodeAVL<T>*) {}
+    static Node* Create(const T& key) { return new Node(key); }
+    static Node* Clone(const NodeAVL<T>* source) { return new Node(source->GetKey()); }
+    static Node* Relocate(void* memory, NodeAVL<T>* source) { return new (memory) Node(source->GetKey()); }
+};
+
+#endif
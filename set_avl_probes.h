@@ -0,0 +1,81 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_AVL_PROBES_H
+#define SET_AVL_PROBES_H
+
+#include <cstdint>
+#include <type_traits>
+
+// SetAVL의 USDT(SystemTap/bpftrace) static probe 정의
+// sys/sdt.h가 있으면 provider "froyo"로 probe가 생성되며,
+// tracer가 붙어있지 않을 때 각 probe는 nop 명령어 하나로 컴파일됨
+// SET_AVL_DISABLE_PROBES를 정의하면 probe를 완전히 제거함
+//
+// probe 목록 (인자)
+//   insert_entry(key), insert_return(key, depth)
+//   erase_entry(key), erase_return(key, depth)
+//   find_entry(key), find_return(key, depth)
+//   rank_entry(key), rank_return(key, depth, rank)
+//   rotation(case, key, height)
+//     case: 1 = Left Left, 2 = Left Right, 3 = Right Left, 4 = Right Right
+//           5, 6 = WeakAVLBalancePolicy의 single rotation (left child, right child를 올림)
+//     key, height: restructuring 전 grand_parent_node의 key와 height
+//                  (case 5, 6은 rotation 전 parent_node의 key와 rank, double rotation은 두 번 기록됨)
+
+#if !defined(SET_AVL_DISABLE_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define SET_AVL_PROBES_ENABLED 1
+#include <sys/sdt.h>
+#endif
+#endif
+
+#if defined(SET_AVL_PROBES_ENABLED)
+#define SET_AVL_PROBE1(name, arg1) \
+    DTRACE_PROBE1(froyo, name, arg1)
+#define SET_AVL_PROBE2(name, arg1, arg2) \
+    DTRACE_PROBE2(froyo, name, arg1, arg2)
+#define SET_AVL_PROBE3(name, arg1, arg2, arg3) \
+    DTRACE_PROBE3(froyo, name, arg1, arg2, arg3)
+#else
+#define SET_AVL_PROBE1(name, arg1) do {} while (0)
+#define SET_AVL_PROBE2(name, arg1, arg2) do {} while (0)
+#define SET_AVL_PROBE3(name, arg1, arg2, arg3) do {} while (0)
+#endif
+
+// rotation probe의 case 값
+enum SetAVLRotationCase
+{
+    kSetAVLRotationLeftLeft = 1,
+    kSetAVLRotationLeftRight = 2,
+    kSetAVLRotationRightLeft = 3,
+    kSetAVLRotationRightRight = 4,
+    kSetAVLRotationUpFromLeft = 5,
+    kSetAVLRotationUpFromRight = 6
+};
+
+// probe 인자는 register 하나에 들어가야 하므로
+// 산술 타입의 key는 정수로, 그 외의 key는 주소로 넘김
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, long long>::type
+SetAVLProbeKey(const T& key)
+{
+    return static_cast<long long>(key);
+}
+
+template <typename T>
+typename std::enable_if<!std::is_arithmetic<T>::value, std::uintptr_t>::type
+SetAVLProbeKey(const T& key)
+{
+    return reinterpret_cast<std::uintptr_t>(&key);
+}
+
+#endif
@@ -0,0 +1,277 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_AVL_SNAPSHOT_H
+#define SET_AVL_SNAPSHOT_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// SetAVL snapshot 파일 형식 (header의 정수는 host byte order)
+//   magic "FRYS" (4byte), version (4byte), encoding (1byte), key size (1byte),
+//   원소의 개수 (8byte), key 목록, payload checksum (8byte)
+// key 목록은 오름차순으로 저장됨
+//   정수 key: 첫 key는 zigzag varint, 이후 key는 (이전 key와의 차이 - 1)의 varint
+//   그 외의 key: sizeof(T) byte를 그대로 저장 (trivially copyable인 경우만 지원)
+// checksum은 key 목록에 대한 FNV-1a 64bit hash
+
+namespace set_avl_snapshot
+{
+constexpr char kMagic[4] = { 'F', 'R', 'Y', 'S' };
+constexpr std::uint32_t kVersion = 1;
+constexpr std::uint8_t kEncodingRaw = 0;
+constexpr std::uint8_t kEncodingDeltaVarint = 1;
+constexpr std::size_t kBufferSize = 1 << 16;
+constexpr std::uint64_t kChecksumOffset = 14695981039346656037ULL;
+constexpr std::uint64_t kChecksumPrime = 1099511628211ULL;
+
+// 버퍼를 이용하여 snapshot 파일을 기록하고 payload의 checksum을 계산
+class Writer
+{
+public:
+    explicit Writer(const std::string& path) :
+        file_(path, std::ios::binary | std::ios::trunc),
+        checksum_(kChecksumOffset) { buffer_.reserve(kBufferSize); }
+
+    bool IsGood() const { return file_.good(); }
+    std::uint64_t GetChecksum() const { return checksum_; }
+
+    // header처럼 checksum에 포함되지 않는 byte를 기록
+    void WriteRaw(const void* data, std::size_t length)
+    {
+        Flush();
+        file_.write(static_cast<const char*>(data), length);
+    }
+
+    // checksum에 포함되는 payload byte를 기록
+    void WritePayload(const void* data, std::size_t length)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            PutByte(bytes[i]);
+        }
+    }
+
+    void WriteVarint(std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            PutByte(static_cast<unsigned char>(value | 0x80));
+            value >>= 7;
+        }
+
+        PutByte(static_cast<unsigned char>(value));
+    }
+
+    void Flush()
+    {
+        if (!buffer_.empty())
+        {
+            file_.write(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+    }
+private:
+    void PutByte(unsigned char byte)
+    {
+        checksum_ = (checksum_ ^ byte) * kChecksumPrime;
+        buffer_.push_back(static_cast<char>(byte));
+
+        if (buffer_.size() == kBufferSize)
+        {
+            Flush();
+        }
+    }
+
+    std::ofstream file_;
+    std::vector<char> buffer_;
+    std::uint64_t checksum_;
+};
+
+// 버퍼를 이용하여 snapshot 파일을 읽고 payload의 checksum을 계산
+// 파일이 중간에 끊긴 경우 IsGood()이 false가 되고 이후 값은 0으로 읽힘
+class Reader
+{
+public:
+    explicit Reader(const std::string& path) :
+        file_(path, std::ios::binary | std::ios::ate), buffer_(kBufferSize),
+        position_(0), length_(0), good_(file_.good()),
+        file_size_(0), read_size_(0), checksum_(kChecksumOffset)
+    {
+        // 끝에서 연 뒤 파일 크기를 구하고 처음으로 돌아감
+        if (good_)
+        {
+            file_size_ = static_cast<std::uint64_t>(file_.tellg());
+            file_.seekg(0);
+            good_ = file_.good();
+        }
+    }
+
+    bool IsGood() const { return good_; }
+    std::uint64_t GetChecksum() const { return checksum_; }
+
+    // 아직 읽지 않은 byte의 개수
+    std::uint64_t GetRemainingSize() const
+    {
+        return file_size_ - read_size_ + (length_ - position_);
+    }
+
+    // header처럼 checksum에 포함되지 않는 byte를 읽음
+    void ReadRaw(void* data, std::size_t length)
+    {
+        unsigned char* bytes = static_cast<unsigned char*>(data);
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            bytes[i] = GetByte();
+        }
+    }
+
+    // checksum에 포함되는 payload byte를 읽음
+    void ReadPayload(void* data, std::size_t length)
+    {
+        unsigned char* bytes = static_cast<unsigned char*>(data);
+
+        for (std::size_t i = 0; i < length; i++)
+        {
+            bytes[i] = GetByte();
+            checksum_ = (checksum_ ^ bytes[i]) * kChecksumPrime;
+        }
+    }
+
+    std::uint64_t ReadVarint()
+    {
+        std::uint64_t value = 0;
+
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            unsigned char byte = GetByte();
+            checksum_ = (checksum_ ^ byte) * kChecksumPrime;
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+
+        // 10byte를 넘는 varint는 잘못된 파일
+        good_ = false;
+        return value;
+    }
+
+    // payload를 모두 읽은 뒤 파일에 남은 byte가 없는지 확인
+    bool IsAtEnd()
+    {
+        if (position_ < length_)
+        {
+            return false;
+        }
+
+        return file_.peek() == std::char_traits<char>::eof();
+    }
+private:
+    unsigned char GetByte()
+    {
+        if (position_ == length_)
+        {
+            file_.read(buffer_.data(), buffer_.size());
+            length_ = static_cast<std::size_t>(file_.gcount());
+            position_ = 0;
+            read_size_ += length_;
+
+            if (length_ == 0)
+            {
+                good_ = false;
+                return 0;
+            }
+        }
+
+        return static_cast<unsigned char>(buffer_[position_++]);
+    }
+
+    std::ifstream file_;
+    std::vector<char> buffer_;
+    std::size_t position_;
+    std::size_t length_;
+    bool good_;
+
+    // 파일의 크기와 지금까지 buffer로 읽어들인 byte의 개수
+    std::uint64_t file_size_;
+    std::uint64_t read_size_;
+
+    std::uint64_t checksum_;
+};
+
+// zigzag 변환 (작은 절댓값의 음수도 짧은 varint가 되도록 함)
+inline std::uint64_t ZigzagEncode(std::int64_t value)
+{
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+inline std::int64_t ZigzagDecode(std::uint64_t value)
+{
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+// 정수 key의 경우 이전 key와의 차이를 varint로 기록
+template <typename T>
+void WriteKey(Writer& writer, const T& key, const T* previous_key, std::true_type)
+{
+    if (previous_key == nullptr)
+    {
+        writer.WriteVarint(ZigzagEncode(static_cast<std::int64_t>(key)));
+    }
+    else
+    {
+        // key는 오름차순이고 중복이 없으므로 차이는 1 이상
+        writer.WriteVarint(static_cast<std::uint64_t>(key)
+            - static_cast<std::uint64_t>(*previous_key) - 1);
+    }
+}
+
+// 정수가 아닌 key는 byte를 그대로 기록
+template <typename T>
+void WriteKey(Writer& writer, const T& key, const T*, std::false_type)
+{
+    writer.WritePayload(&key, sizeof(T));
+}
+
+template <typename T>
+T ReadKey(Reader& reader, const T* previous_key, std::true_type)
+{
+    if (previous_key == nullptr)
+    {
+        return static_cast<T>(ZigzagDecode(reader.ReadVarint()));
+    }
+    else
+    {
+        return static_cast<T>(static_cast<std::uint64_t>(*previous_key)
+            + reader.ReadVarint() + 1);
+    }
+}
+
+template <typename T>
+T ReadKey(Reader& reader, const T*, std::false_type)
+{
+    T key;
+    reader.ReadPayload(&key, sizeof(T));
+    return key;
+}
+}
+
+#endif
@@ -0,0 +1,161 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_AVL_WAL_H
+#define SET_AVL_WAL_H
+
+#include "set_avl.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// SetAVL의 Insert, Erase를 write-ahead log에 기록하여 crash 이후에도 복구할 수 있게 함
+// 여러 thread가 동시에 호출하면 group_commit_window 동안 모인 record를
+// 한 번의 write + fdatasync로 기록함 (group commit)
+// checkpoint_interval개의 record마다 snapshot을 만들고 log를 비움
+// log의 write 또는 fdatasync가 실패하면 log는 실패 상태로 남고(IsFailed), 디스크에 기록되지 못한
+// mutation은 set에서 되돌린 뒤 기다리던 모든 호출이 -1을 return함 (이후의 Insert, Erase도 -1)
+// 실패한 기록의 일부가 log에 남지 않도록 마지막으로 기록에 성공한 위치까지 log를 잘라냄
+//
+// directory 안의 파일
+//   snapshot      : 마지막 checkpoint의 SetAVL snapshot (SaveSnapshot 형식)
+//   snapshot.tmp  : checkpoint 도중에 쓰는 임시 파일
+//   log           : checkpoint 이후의 mutation record
+// record 형식: type (1byte, 'I' 또는 'E'), key (sizeof(T) byte), checksum (4byte)
+template <typename T>
+class SetAVLWriteAheadLog
+{
+public:
+    SetAVLWriteAheadLog(
+        SetAVL<T>& set,
+        const std::string& directory,
+        std::chrono::microseconds group_commit_window,
+        int checkpoint_interval);
+    ~SetAVLWriteAheadLog();
+
+    // snapshot과 log를 읽어 set을 복구하고 log에 이어서 기록할 준비를 함
+    // set의 기존 내용은 snapshot의 내용으로 교체됨
+    bool Open();
+
+    // set에 key를 삽입하고, log가 디스크에 기록된 뒤 해당 node의 depth를 return
+    // (key가 이미 있거나 log가 실패 상태이면 -1)
+    int Insert(const T key);
+
+    // set에서 key를 삭제하고, log가 디스크에 기록된 뒤 해당 node의 depth를 return
+    // (key가 없거나 log가 실패 상태이면 -1)
+    int Erase(const T key);
+
+    // 현재 set의 snapshot을 만들고 log를 비움
+    bool Checkpoint();
+
+    // fdatasync를 호출한 횟수 (group commit의 효과 확인용)
+    long long GetSyncCount() const;
+
+    // 디스크에 기록된 record의 개수
+    long long GetDurableRecordCount() const;
+
+    // log 기록에 실패하여 더 이상 mutation을 받지 않는 상태이면 true
+    bool IsFailed() const;
+private:
+    // 복사 생성자, 대입 연산자 사용 방지
+    SetAVLWriteAheadLog(const SetAVLWriteAheadLog&);
+    void operator=(const SetAVLWriteAheadLog&);
+
+    // record 하나의 크기
+    static constexpr std::size_t kRecordSize = 1 + sizeof(T) + sizeof(std::uint32_t);
+
+    // record의 type
+    static constexpr char kInsertRecord = 'I';
+    static constexpr char kEraseRecord = 'E';
+
+    // mutation을 set에 적용하고 record를 buffer에 추가한 뒤 디스크에 기록될 때까지 기다림
+    int Apply(char type, const T key);
+
+    // sequence_number까지의 record가 디스크에 기록될 때까지 기다림
+    // 기록을 진행 중인 thread가 없으면 호출한 thread가 leader가 되어 기록함
+    // log가 실패 상태가 되어 기록되지 못하면 false
+    bool WaitUntilDurable(long long sequence_number, std::unique_lock<std::mutex>& lock);
+
+    // buffer에 있는 record를 log에 기록하고 fdatasync 호출
+    // flush_in_progress_를 true로 설정하고 lock을 잡은 상태에서 호출
+    // 디스크에 기록하는 동안에는 lock을 풀어둠
+    // 실패하면 log를 실패 상태로 만들고 FailLocked로 정리함
+    bool FlushLocked(std::unique_lock<std::mutex>& lock);
+
+    // buffer가 빌 때까지 FlushLocked를 반복 (checkpoint 전에 호출)
+    bool FlushAllLocked(std::unique_lock<std::mutex>& lock);
+
+    // log를 durable_log_size_까지 잘라내고, 기록되지 못한 records와 buffer의 mutation을
+    // 나중에 적용된 것부터 set에서 되돌린 뒤 실패 상태로 만듦
+    void FailLocked(const std::vector<char>& records);
+
+    // snapshot을 만들고 log를 비움
+    // flush_in_progress_를 true로 설정하고 lock을 잡은 상태에서 buffer가 비어있을 때 호출
+    bool CheckpointLocked();
+
+    // log에 있는 record를 set에 다시 적용하고 손상된 꼬리 부분을 잘라냄
+    bool ReplayLog();
+
+    // record의 checksum (FNV-1a 32bit)
+    static std::uint32_t ComputeChecksum(const char* data, std::size_t length);
+
+    // 로그를 적용할 Set
+    SetAVL<T>& set_;
+
+    // snapshot, log 파일의 경로
+    std::string snapshot_path_;
+    std::string temporary_snapshot_path_;
+    std::string log_path_;
+    std::string directory_;
+
+    // leader가 record를 모으기 위해 기다리는 시간
+    std::chrono::microseconds group_commit_window_;
+
+    // checkpoint를 진행할 record의 개수
+    int checkpoint_interval_;
+
+    // log 파일의 file descriptor
+    int log_file_descriptor_;
+
+    // set_과 아래의 상태를 보호하는 mutex
+    mutable std::mutex mutex_;
+    std::condition_variable durable_condition_;
+
+    // 아직 디스크에 기록되지 않은 record
+    std::vector<char> buffer_;
+
+    // 마지막으로 부여한 record 번호와 디스크에 기록된 마지막 record 번호
+    long long last_sequence_number_;
+    long long durable_sequence_number_;
+
+    // leader thread가 기록 중인지 여부
+    bool flush_in_progress_;
+
+    // 마지막 checkpoint 이후에 기록된 record의 개수
+    long long records_since_checkpoint_;
+
+    // 디스크에 기록된 것이 확인된 log의 크기 (byte)
+    long long durable_log_size_;
+
+    // log 기록에 실패했는지 여부 (한 번 true가 되면 Open을 다시 호출할 때까지 유지)
+    bool failed_;
+
+    // fdatasync를 호출한 횟수
+    long long sync_count_;
+};
+
+#include "set_avl_wal.hpp"
+
+#endif
@@ -0,0 +1,550 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "set_avl_wal.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace set_avl_wal_internal
+{
+// 데이터를 모두 기록할 때까지 write를 반복
+inline bool WriteAll(int file_descriptor, const char* data, std::size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = write(file_descriptor, data, length);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        data += written;
+        length -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+
+// 파일 또는 디렉터리의 내용을 디스크에 반영
+inline bool SyncPath(const std::string& path)
+{
+    int file_descriptor = open(path.c_str(), O_RDONLY);
+
+    if (file_descriptor < 0)
+    {
+        return false;
+    }
+
+    bool result = (fsync(file_descriptor) == 0);
+    close(file_descriptor);
+
+    return result;
+}
+}
+
+// 생성자 정의
+template <typename T>
+SetAVLWriteAheadLog<T>::SetAVLWriteAheadLog(
+    SetAVL<T>& set,
+    const std::string& directory,
+    std::chrono::microseconds group_commit_window,
+    int checkpoint_interval) :
+    set_(set),
+    snapshot_path_(directory + "/snapshot"),
+    temporary_snapshot_path_(directory + "/snapshot.tmp"),
+    log_path_(directory + "/log"),
+    directory_(directory),
+    group_commit_window_(group_commit_window),
+    checkpoint_interval_(checkpoint_interval),
+    log_file_descriptor_(-1),
+    last_sequence_number_(0),
+    durable_sequence_number_(0),
+    flush_in_progress_(false),
+    records_since_checkpoint_(0),
+    durable_log_size_(0),
+    failed_(false),
+    sync_count_(0)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+        "SetAVLWriteAheadLog requires a trivially copyable key type");
+}
+
+// 소멸자 정의
+template <typename T>
+SetAVLWriteAheadLog<T>::~SetAVLWriteAheadLog()
+{
+    if (log_file_descriptor_ != -1)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // 기록 중인 leader가 끝날 때까지 기다린 뒤 남은 record를 기록
+        durable_condition_.wait(lock, [this]() { return !flush_in_progress_; });
+        flush_in_progress_ = true;
+
+        if (!failed_)
+        {
+            FlushLocked(lock);
+        }
+
+        close(log_file_descriptor_);
+    }
+}
+
+// snapshot과 log를 읽어 set을 복구
+template <typename T>
+bool SetAVLWriteAheadLog<T>::Open()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    records_since_checkpoint_ = 0;
+
+    // directory가 없으면 새로 만듦
+    if (mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST)
+    {
+        return false;
+    }
+
+    // 중단된 checkpoint의 임시 파일은 버림
+    std::remove(temporary_snapshot_path_.c_str());
+
+    struct stat snapshot_status;
+
+    if (stat(snapshot_path_.c_str(), &snapshot_status) == 0)
+    {
+        if (!set_.LoadSnapshot(snapshot_path_))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        // snapshot이 없으면 빈 Set에서 시작
+        set_.Clear();
+    }
+
+    if (!ReplayLog())
+    {
+        return false;
+    }
+
+    if (log_file_descriptor_ != -1)
+    {
+        close(log_file_descriptor_);
+    }
+
+    log_file_descriptor_ = open(log_path_.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+    if (log_file_descriptor_ == -1)
+    {
+        return false;
+    }
+
+    // ReplayLog가 손상된 꼬리를 잘라냈으므로 현재 log 전체가 디스크에 기록된 부분
+    off_t log_size = lseek(log_file_descriptor_, 0, SEEK_END);
+
+    if (log_size < 0)
+    {
+        return false;
+    }
+
+    durable_log_size_ = static_cast<long long>(log_size);
+    buffer_.clear();
+    durable_sequence_number_ = last_sequence_number_;
+    failed_ = false;
+
+    return true;
+}
+
+// log에 있는 record를 set에 다시 적용
+template <typename T>
+bool SetAVLWriteAheadLog<T>::ReplayLog()
+{
+    int file_descriptor = open(log_path_.c_str(), O_RDWR | O_CREAT, 0644);
+
+    if (file_descriptor < 0)
+    {
+        return false;
+    }
+
+    std::vector<char> contents;
+    char chunk[1 << 16];
+    ssize_t length;
+
+    while ((length = read(file_descriptor, chunk, sizeof(chunk))) != 0)
+    {
+        if (length < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // 읽지 못한 뒷부분을 손상된 꼬리로 보고 잘라내면 기록된 record를 잃으므로 실패로 처리
+            close(file_descriptor);
+            return false;
+        }
+
+        contents.insert(contents.end(), chunk, chunk + length);
+    }
+
+    // Insert, Erase는 마지막으로 적용된 연산만 결과에 영향을 주므로
+    // checkpoint 직후 log가 비워지기 전에 crash가 나서 snapshot에 이미 반영된 record를
+    // 다시 적용하더라도 같은 결과가 됨
+    std::size_t valid_length = 0;
+
+    while (valid_length + kRecordSize <= contents.size())
+    {
+        const char* record = contents.data() + valid_length;
+        std::uint32_t checksum;
+        std::memcpy(&checksum, record + 1 + sizeof(T), sizeof(checksum));
+
+        if (checksum != ComputeChecksum(record, 1 + sizeof(T))
+            || (record[0] != kInsertRecord && record[0] != kEraseRecord))
+        {
+            // 기록 도중 crash가 난 record
+            break;
+        }
+
+        T key;
+        std::memcpy(&key, record + 1, sizeof(T));
+
+        if (record[0] == kInsertRecord)
+        {
+            set_.Insert(key);
+        }
+        else
+        {
+            set_.Erase(key);
+        }
+
+        valid_length += kRecordSize;
+        records_since_checkpoint_++;
+    }
+
+    // 손상된 꼬리 부분을 잘라내서 이후의 record가 그 뒤에 붙지 않도록 함
+    bool result = true;
+
+    if (valid_length != contents.size())
+    {
+        result = (ftruncate(file_descriptor, static_cast<off_t>(valid_length)) == 0)
+            && (fdatasync(file_descriptor) == 0);
+    }
+
+    close(file_descriptor);
+
+    return result;
+}
+
+// set에 key를 삽입하고 log가 디스크에 기록된 뒤 depth를 return
+template <typename T>
+int SetAVLWriteAheadLog<T>::Insert(const T key)
+{
+    return Apply(kInsertRecord, key);
+}
+
+// set에서 key를 삭제하고 log가 디스크에 기록된 뒤 depth를 return
+template <typename T>
+int SetAVLWriteAheadLog<T>::Erase(const T key)
+{
+    return Apply(kEraseRecord, key);
+}
+
+// mutation을 set에 적용하고 record가 디스크에 기록될 때까지 기다림
+template <typename T>
+int SetAVLWriteAheadLog<T>::Apply(char type, const T key)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (failed_)
+    {
+        // 기록할 수 없는 mutation은 set에 적용하지 않음
+        return -1;
+    }
+
+    int depth = (type == kInsertRecord) ? set_.Insert(key) : set_.Erase(key);
+
+    if (depth != -1)
+    {
+        // set이 변경된 경우에만 record를 추가
+        char record[kRecordSize];
+        record[0] = type;
+        std::memcpy(record + 1, &key, sizeof(T));
+
+        std::uint32_t checksum = ComputeChecksum(record, 1 + sizeof(T));
+        std::memcpy(record + 1 + sizeof(T), &checksum, sizeof(checksum));
+
+        buffer_.insert(buffer_.end(), record, record + kRecordSize);
+        last_sequence_number_++;
+    }
+
+    // set이 변경되지 않은 경우에도 이 결과가 의존하는 이전 record가 기록될 때까지 기다림
+    // 기록에 실패하면 mutation은 이미 set에서 되돌려져 있음
+    if (!WaitUntilDurable(last_sequence_number_, lock))
+    {
+        return -1;
+    }
+
+    return depth;
+}
+
+// sequence_number까지의 record가 디스크에 기록될 때까지 기다림
+template <typename T>
+bool SetAVLWriteAheadLog<T>::WaitUntilDurable(
+    long long sequence_number,
+    std::unique_lock<std::mutex>& lock)
+{
+    while (durable_sequence_number_ < sequence_number)
+    {
+        if (failed_)
+        {
+            // leader의 기록이 실패하여 이 record는 기록되지 않음
+            return false;
+        }
+
+        if (flush_in_progress_)
+        {
+            // 다른 thread가 leader로 기록 중이므로 기다림
+            durable_condition_.wait(lock);
+            continue;
+        }
+
+        // 호출한 thread가 leader가 되어 기록함
+        flush_in_progress_ = true;
+
+        if (group_commit_window_.count() > 0)
+        {
+            // 다른 thread의 record가 모일 때까지 lock을 풀고 기다림
+            lock.unlock();
+            std::this_thread::sleep_for(group_commit_window_);
+            lock.lock();
+        }
+
+        if (FlushLocked(lock)
+            && checkpoint_interval_ > 0 && records_since_checkpoint_ >= checkpoint_interval_
+            && FlushAllLocked(lock))
+        {
+            CheckpointLocked();
+        }
+
+        // 실패한 경우에도 기다리던 thread를 모두 깨워서 -1을 return하게 함
+        flush_in_progress_ = false;
+        durable_condition_.notify_all();
+    }
+
+    return true;
+}
+
+// buffer에 있는 record를 log에 기록하고 fdatasync 호출
+template <typename T>
+bool SetAVLWriteAheadLog<T>::FlushLocked(std::unique_lock<std::mutex>& lock)
+{
+    if (buffer_.empty())
+    {
+        return true;
+    }
+
+    std::vector<char> records;
+    records.swap(buffer_);
+    long long target_sequence_number = last_sequence_number_;
+
+    // 기록하는 동안 다른 thread가 다음 group의 record를 추가할 수 있도록 lock을 풂
+    // flush_in_progress_가 true이므로 log에 동시에 기록하는 thread는 없음
+    lock.unlock();
+
+    bool result = set_avl_wal_internal::WriteAll(
+        log_file_descriptor_, records.data(), records.size())
+        && fdatasync(log_file_descriptor_) == 0;
+
+    lock.lock();
+    sync_count_++;
+
+    if (result)
+    {
+        durable_sequence_number_ = target_sequence_number;
+        durable_log_size_ += static_cast<long long>(records.size());
+        records_since_checkpoint_ += static_cast<long long>(records.size() / kRecordSize);
+    }
+    else
+    {
+        // 일부만 기록되었을 수 있으므로 같은 record를 다시 기록하지 않고 실패 상태로 만듦
+        FailLocked(records);
+    }
+
+    return result;
+}
+
+// buffer가 빌 때까지 기록을 반복
+template <typename T>
+bool SetAVLWriteAheadLog<T>::FlushAllLocked(std::unique_lock<std::mutex>& lock)
+{
+    // FlushLocked가 lock을 푼 동안 다른 thread가 record를 추가할 수 있음
+    // 각 thread는 record를 하나 추가한 뒤 기록을 기다리므로 반복은 끝남
+    while (!buffer_.empty())
+    {
+        if (!FlushLocked(lock))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// 기록에 실패한 log를 정리하고 set을 디스크에 기록된 상태로 되돌림
+template <typename T>
+void SetAVLWriteAheadLog<T>::FailLocked(const std::vector<char>& records)
+{
+    failed_ = true;
+
+    // 일부만 기록된 record가 log에 남으면 replay가 그 record에서 멈추므로
+    // 마지막으로 기록에 성공한 위치까지 잘라냄 (실패해도 replay는 checksum으로 꼬리를 버림)
+    if (ftruncate(log_file_descriptor_, static_cast<off_t>(durable_log_size_)) == 0)
+    {
+        fdatasync(log_file_descriptor_);
+    }
+
+    // buffer의 record는 records보다 나중에 적용되었으므로 buffer부터 역순으로 되돌림
+    // record는 set이 변경된 경우에만 추가되므로 Insert는 Erase로, Erase는 Insert로 되돌릴 수 있음
+    auto undo = [this](const std::vector<char>& undo_records)
+    {
+        for (std::size_t offset = undo_records.size(); offset >= kRecordSize; offset -= kRecordSize)
+        {
+            const char* record = undo_records.data() + offset - kRecordSize;
+            T key;
+            std::memcpy(&key, record + 1, sizeof(T));
+
+            if (record[0] == kInsertRecord)
+            {
+                set_.Erase(key);
+            }
+            else
+            {
+                set_.Insert(key);
+            }
+        }
+    };
+
+    undo(buffer_);
+    undo(records);
+    buffer_.clear();
+}
+
+// 현재 set의 snapshot을 만들고 log를 비움
+template <typename T>
+bool SetAVLWriteAheadLog<T>::Checkpoint()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    durable_condition_.wait(lock, [this]() { return !flush_in_progress_; });
+
+    if (failed_)
+    {
+        return false;
+    }
+
+    flush_in_progress_ = true;
+
+    bool result = FlushAllLocked(lock) && CheckpointLocked();
+
+    flush_in_progress_ = false;
+    durable_condition_.notify_all();
+
+    return result;
+}
+
+// snapshot을 만들고 log를 비움
+// buffer가 빈 상태에서 호출하므로 snapshot에는 디스크에 기록된 mutation만 들어감
+// (기록에 실패하여 set에서 되돌린 mutation이 snapshot에 남지 않음)
+template <typename T>
+bool SetAVLWriteAheadLog<T>::CheckpointLocked()
+{
+    // 임시 파일에 snapshot을 쓰고 디스크에 반영한 뒤 rename으로 교체
+    if (!set_.SaveSnapshot(temporary_snapshot_path_)
+        || !set_avl_wal_internal::SyncPath(temporary_snapshot_path_)
+        || std::rename(temporary_snapshot_path_.c_str(), snapshot_path_.c_str()) != 0
+        || !set_avl_wal_internal::SyncPath(directory_))
+    {
+        return false;
+    }
+
+    // snapshot에 모든 record가 반영되었으므로 log를 비움
+    if (ftruncate(log_file_descriptor_, 0) != 0)
+    {
+        return false;
+    }
+
+    // snapshot에 반영되었으므로 fdatasync가 실패하더라도 log에 남은 record는 다시 적용해도 같은 결과
+    durable_log_size_ = 0;
+
+    if (fdatasync(log_file_descriptor_) != 0)
+    {
+        return false;
+    }
+
+    records_since_checkpoint_ = 0;
+
+    return true;
+}
+
+// fdatasync를 호출한 횟수
+template <typename T>
+long long SetAVLWriteAheadLog<T>::GetSyncCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return sync_count_;
+}
+
+// 디스크에 기록된 record의 개수
+template <typename T>
+long long SetAVLWriteAheadLog<T>::GetDurableRecordCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return durable_sequence_number_;
+}
+
+// log 기록에 실패한 상태인지 여부
+template <typename T>
+bool SetAVLWriteAheadLog<T>::IsFailed() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return failed_;
+}
+
+// record의 checksum (FNV-1a 32bit)
+template <typename T>
+std::uint32_t SetAVLWriteAheadLog<T>::ComputeChecksum(const char* data, std::size_t length)
+{
+    std::uint32_t checksum = 2166136261u;
+
+    for (std::size_t i = 0; i < length; i++)
+    {
+        checksum = (checksum ^ static_cast<unsigned char>(data[i])) * 16777619u;
+    }
+
+    return checksum;
+}
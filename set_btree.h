@@ -0,0 +1,115 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_BTREE_H
+#define SET_BTREE_H
+
+#include "node_btree.h"
+#include "set.h"
+
+// node 하나에 여러 key를 저장하는 B+-tree Set
+// node의 크기가 cache line의 배수이므로 node 하나를 읽을 때 key 여러 개를 함께 비교함
+// key는 모두 leaf에 있고 leaf끼리 연결되어 있으므로 범위 탐색이 빠름
+//
+// 모든 leaf의 depth가 같으므로 key의 depth는 key가 들어있는 leaf의 depth로 정의
+// Minimum, Maximum은 key가 들어있는 leaf를 key의 subtree로 봄
+template <typename T>
+class SetBTree : public Set<T>
+{
+public:
+    SetBTree() : size_(0), height_(0), root_(nullptr), first_leaf_(nullptr) {}
+    ~SetBTree();
+
+    // Basic 기능
+    // key가 들어있는 leaf에서 최솟값과 depth를 출력
+    void Minimum(const T key) override final;
+
+    // key가 들어있는 leaf에서 최댓값과 depth를 출력
+    void Maximum(const T key) override final;
+
+    // Set이 비어있으면 1, 그렇지 않으면 0을 return
+    bool IsEmpty() const override final { return size_ == 0; }
+
+    // Set에 들어있는 원소의 개수 return
+    int GetSize() const override final { return size_; }
+
+    // 해당 key의 depth를 return (없으면 -1)
+    int Find(const T key) override final;
+
+    // key를 삽입하고 depth를 return (이미 있으면 -1)
+    int Insert(const T key) override final;
+
+    // Advanced 기능
+    // 해당 key의 depth와 rank를 출력
+    // rank: Set에서 해당 key보다 작은 key의 개수 + 1
+    void Rank(const T key) override final;
+
+    // 해당 key를 삭제하고 depth를 return (없으면 -1)
+    int Erase(const T key) override final;
+
+    // first 이상 last 이하인 key를 오름차순으로 function에 전달하고 전달한 개수를 return
+    // 첫 leaf를 찾은 뒤에는 연결된 leaf를 따라가며 읽음
+    template <typename Function>
+    int ForEachInRange(const T& first, const T& last, Function function) const;
+
+    // tree의 높이 (leaf만 있으면 1, 비어있으면 0)
+    int GetHeight() const { return height_; }
+private:
+    typedef NodeBTree<T> Node;
+    typedef LeafNodeBTree<T> Leaf;
+    typedef InternalNodeBTree<T> Internal;
+
+    // leaf의 최소 key 개수, internal node의 최소 separator 개수 (root 제외)
+    static constexpr int kMinLeafCount = Leaf::kCapacity / 2;
+    static constexpr int kMinInternalCount = (Internal::kCapacity - 1) / 2;
+
+    // 복사 생성자, 대입 연산자 사용 방지
+    SetBTree(const SetBTree&) = delete;
+    SetBTree& operator=(const SetBTree&) = delete;
+
+    // node를 root로 하는 subtree를 모두 해제
+    static void DeleteSubtree(Node* node);
+
+    // node를 root로 하는 subtree의 원소 개수
+    static int GetSubtreeSize(const Node* node);
+
+    // key가 들어있을 leaf (비어있으면 nullptr), out_rank에는 leaf 앞의 원소 개수를 저장
+    Leaf* FindLeaf(const T& key, int* out_rank) const;
+
+    // node에 key를 삽입
+    // node가 분할되면 out_split에 새 오른쪽 node, out_separator에 왼쪽 node의 최댓값을 저장
+    bool InsertRecursive(Node* node, const T& key, Node*& out_split, T& out_separator);
+
+    // node에서 key를 삭제 (없으면 false)
+    bool EraseRecursive(Node* node, const T& key);
+
+    // parent의 index번째 child와 그 앞의 separator를 제거 (child의 원소 개수는 앞 child에 더함)
+    static void RemoveChild(Internal* parent, int index);
+
+    // parent의 index번째 child의 key 개수가 최소보다 적으면 이웃 child에서 빌리거나 합침
+    void FixUnderflow(Internal* parent, int index);
+
+    // Set에 들어있는 원소의 개수
+    int size_;
+
+    // tree의 높이
+    int height_;
+
+    // root node
+    Node* root_;
+
+    // 가장 왼쪽 leaf
+    Leaf* first_leaf_;
+};
+
+#include "set_btree.hpp"
+
+#endif
@@ -0,0 +1,587 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "set_btree.h"
+
+#include <algorithm>
+#include <iostream>
+
+template <typename T>
+SetBTree<T>::~SetBTree()
+{
+    DeleteSubtree(root_);
+}
+
+// key가 들어있는 leaf에서 최솟값과 depth를 출력
+template <typename T>
+void SetBTree<T>::Minimum(const T key)
+{
+    const Leaf* leaf = FindLeaf(key, nullptr);
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (leaf == nullptr || Find(key) == -1)
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    std::cout << leaf->keys_[0] << " " << height_ - 1 << "\n";
+}
+
+// key가 들어있는 leaf에서 최댓값과 depth를 출력
+template <typename T>
+void SetBTree<T>::Maximum(const T key)
+{
+    const Leaf* leaf = FindLeaf(key, nullptr);
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (leaf == nullptr || Find(key) == -1)
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    std::cout << leaf->keys_[leaf->count_ - 1] << " " << height_ - 1 << "\n";
+}
+
+// 해당 key의 depth를 return
+template <typename T>
+int SetBTree<T>::Find(const T key)
+{
+    const Leaf* leaf = FindLeaf(key, nullptr);
+
+    if (leaf == nullptr)
+    {
+        return -1;
+    }
+
+    int index = Leaf::KeySearch::CountLessThan(leaf->keys_, leaf->count_, key);
+
+    if (index == leaf->count_ || !(leaf->keys_[index] == key))
+    {
+        return -1;
+    }
+
+    return height_ - 1;
+}
+
+// key를 삽입하고 depth를 return
+template <typename T>
+int SetBTree<T>::Insert(const T key)
+{
+    if (root_ == nullptr)
+    {
+        first_leaf_ = new Leaf();
+        root_ = first_leaf_;
+        height_ = 1;
+    }
+
+    Node* split = nullptr;
+    T separator = T();
+
+    if (!InsertRecursive(root_, key, split, separator))
+    {
+        // 삽입하려고 하는 원소가 이미 Set에 들어있음
+        return -1;
+    }
+
+    size_++;
+
+    if (split != nullptr)
+    {
+        // root가 분할되었으므로 새 root를 만듦
+        Internal* new_root = new Internal();
+        new_root->keys_[0] = separator;
+        new_root->children_[0] = root_;
+        new_root->children_[1] = split;
+        new_root->child_sizes_[0] = GetSubtreeSize(root_);
+        new_root->child_sizes_[1] = GetSubtreeSize(split);
+        new_root->count_ = 1;
+
+        root_ = new_root;
+        height_++;
+    }
+
+    return height_ - 1;
+}
+
+// 해당 key의 depth와 rank를 출력
+template <typename T>
+void SetBTree<T>::Rank(const T key)
+{
+    int rank = 0;
+    const Leaf* leaf = FindLeaf(key, &rank);
+    int index = (leaf == nullptr) ? 0 : Leaf::KeySearch::CountLessThan(leaf->keys_, leaf->count_, key);
+
+    if (leaf == nullptr || index == leaf->count_ || !(leaf->keys_[index] == key))
+        std::cout << "0\n";
+    else
+        std::cout << height_ - 1 << " " << rank + index + 1;
+}
+
+// 해당 key를 삭제하고 depth를 return
+template <typename T>
+int SetBTree<T>::Erase(const T key)
+{
+    if (root_ == nullptr || !EraseRecursive(root_, key))
+    {
+        // 삭제하려고 하는 원소를 찾지 못함
+        return -1;
+    }
+
+    int depth = height_ - 1;
+    size_--;
+
+    if (root_->is_leaf_)
+    {
+        if (root_->count_ == 0)
+        {
+            delete static_cast<Leaf*>(root_);
+            root_ = nullptr;
+            first_leaf_ = nullptr;
+            height_ = 0;
+        }
+    }
+    else if (root_->count_ == 0)
+    {
+        // root에 child가 하나만 남았으므로 child를 root로 만듦
+        Internal* old_root = static_cast<Internal*>(root_);
+        root_ = old_root->children_[0];
+        delete old_root;
+        height_--;
+    }
+
+    return depth;
+}
+
+// first 이상 last 이하인 key를 오름차순으로 function에 전달
+template <typename T>
+template <typename Function>
+int SetBTree<T>::ForEachInRange(const T& first, const T& last, Function function) const
+{
+    const Leaf* leaf = FindLeaf(first, nullptr);
+    int index = (leaf == nullptr) ? 0 : Leaf::KeySearch::CountLessThan(leaf->keys_, leaf->count_, first);
+    int visited = 0;
+
+    while (leaf != nullptr)
+    {
+        for (; index < leaf->count_; index++)
+        {
+            if (last < leaf->keys_[index])
+            {
+                return visited;
+            }
+
+            function(leaf->keys_[index]);
+            visited++;
+        }
+
+        leaf = leaf->next_;
+        index = 0;
+    }
+
+    return visited;
+}
+
+// node를 root로 하는 subtree를 모두 해제
+template <typename T>
+void SetBTree<T>::DeleteSubtree(Node* node)
+{
+    if (node == nullptr)
+    {
+        return;
+    }
+
+    if (node->is_leaf_)
+    {
+        delete static_cast<Leaf*>(node);
+        return;
+    }
+
+    Internal* internal = static_cast<Internal*>(node);
+
+    for (int i = 0; i <= internal->count_; i++)
+    {
+        DeleteSubtree(internal->children_[i]);
+    }
+
+    delete internal;
+}
+
+// node를 root로 하는 subtree의 원소 개수
+template <typename T>
+int SetBTree<T>::GetSubtreeSize(const Node* node)
+{
+    if (node->is_leaf_)
+    {
+        return node->count_;
+    }
+
+    const Internal* internal = static_cast<const Internal*>(node);
+    int size = 0;
+
+    for (int i = 0; i <= internal->count_; i++)
+    {
+        size += internal->child_sizes_[i];
+    }
+
+    return size;
+}
+
+// key가 들어있을 leaf를 찾음
+template <typename T>
+typename SetBTree<T>::Leaf* SetBTree<T>::FindLeaf(const T& key, int* out_rank) const
+{
+    Node* node = root_;
+    int rank = 0;
+
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+
+    while (!node->is_leaf_)
+    {
+        const Internal* internal = static_cast<const Internal*>(node);
+        int index = Internal::KeySearch::CountLessThan(internal->keys_, internal->count_, key);
+
+        if (out_rank != nullptr)
+        {
+            // 왼쪽 child의 원소는 모두 key보다 작음
+            for (int i = 0; i < index; i++)
+            {
+                rank += internal->child_sizes_[i];
+            }
+        }
+
+        node = internal->children_[index];
+    }
+
+    if (out_rank != nullptr)
+    {
+        *out_rank = rank;
+    }
+
+    return static_cast<Leaf*>(node);
+}
+
+// node에 key를 삽입
+template <typename T>
+bool SetBTree<T>::InsertRecursive(Node* node, const T& key, Node*& out_split, T& out_separator)
+{
+    if (node->is_leaf_)
+    {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        int index = Leaf::KeySearch::CountLessThan(leaf->keys_, leaf->count_, key);
+
+        if (index < leaf->count_ && leaf->keys_[index] == key)
+        {
+            return false;
+        }
+
+        std::copy_backward(leaf->keys_ + index, leaf->keys_ + leaf->count_,
+            leaf->keys_ + leaf->count_ + 1);
+        leaf->keys_[index] = key;
+        leaf->count_++;
+
+        if (leaf->count_ <= Leaf::kCapacity)
+        {
+            return true;
+        }
+
+        // 가득 찬 leaf를 반으로 나누고 오른쪽 절반을 새 leaf로 옮김
+        Leaf* right = new Leaf();
+        int right_count = leaf->count_ / 2;
+        int left_count = leaf->count_ - right_count;
+
+        std::copy(leaf->keys_ + left_count, leaf->keys_ + leaf->count_, right->keys_);
+        right->count_ = right_count;
+        leaf->count_ = left_count;
+        Leaf::KeySearch::FillPadding(leaf->keys_, left_count);
+
+        right->prev_ = leaf;
+        right->next_ = leaf->next_;
+
+        if (leaf->next_ != nullptr)
+        {
+            leaf->next_->prev_ = right;
+        }
+
+        leaf->next_ = right;
+
+        out_split = right;
+        out_separator = leaf->keys_[left_count - 1];
+
+        return true;
+    }
+
+    Internal* internal = static_cast<Internal*>(node);
+    int index = Internal::KeySearch::CountLessThan(internal->keys_, internal->count_, key);
+    Node* split = nullptr;
+    T separator = T();
+
+    if (!InsertRecursive(internal->children_[index], key, split, separator))
+    {
+        return false;
+    }
+
+    internal->child_sizes_[index]++;
+
+    if (split == nullptr)
+    {
+        return true;
+    }
+
+    // 분할된 child의 separator와 새 child를 index 뒤에 끼워 넣음
+    const int count = internal->count_;
+
+    std::copy_backward(internal->keys_ + index, internal->keys_ + count,
+        internal->keys_ + count + 1);
+    std::copy_backward(internal->children_ + index + 1, internal->children_ + count + 1,
+        internal->children_ + count + 2);
+    std::copy_backward(internal->child_sizes_ + index + 1, internal->child_sizes_ + count + 1,
+        internal->child_sizes_ + count + 2);
+
+    internal->keys_[index] = separator;
+    internal->children_[index + 1] = split;
+    internal->child_sizes_[index] = GetSubtreeSize(internal->children_[index]);
+    internal->child_sizes_[index + 1] = GetSubtreeSize(split);
+    internal->count_++;
+
+    if (internal->count_ <= Internal::kCapacity)
+    {
+        return true;
+    }
+
+    // 가운데 separator는 parent로 올리고 오른쪽 절반을 새 node로 옮김
+    Internal* right = new Internal();
+    int middle = internal->count_ / 2;
+
+    right->count_ = internal->count_ - middle - 1;
+    std::copy(internal->keys_ + middle + 1, internal->keys_ + internal->count_, right->keys_);
+    std::copy(internal->children_ + middle + 1, internal->children_ + internal->count_ + 1,
+        right->children_);
+    std::copy(internal->child_sizes_ + middle + 1, internal->child_sizes_ + internal->count_ + 1,
+        right->child_sizes_);
+
+    out_separator = internal->keys_[middle];
+    out_split = right;
+
+    internal->count_ = middle;
+    Internal::KeySearch::FillPadding(internal->keys_, middle);
+
+    return true;
+}
+
+// node에서 key를 삭제
+template <typename T>
+bool SetBTree<T>::EraseRecursive(Node* node, const T& key)
+{
+    if (node->is_leaf_)
+    {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        int index = Leaf::KeySearch::CountLessThan(leaf->keys_, leaf->count_, key);
+
+        if (index == leaf->count_ || !(leaf->keys_[index] == key))
+        {
+            return false;
+        }
+
+        std::copy(leaf->keys_ + index + 1, leaf->keys_ + leaf->count_, leaf->keys_ + index);
+        leaf->count_--;
+        Leaf::KeySearch::FillPadding(leaf->keys_, leaf->count_);
+
+        return true;
+    }
+
+    Internal* internal = static_cast<Internal*>(node);
+    int index = Internal::KeySearch::CountLessThan(internal->keys_, internal->count_, key);
+
+    if (!EraseRecursive(internal->children_[index], key))
+    {
+        return false;
+    }
+
+    internal->child_sizes_[index]--;
+
+    const Node* child = internal->children_[index];
+    const int min_count = child->is_leaf_ ? kMinLeafCount : kMinInternalCount;
+
+    if (child->count_ < min_count)
+    {
+        FixUnderflow(internal, index);
+    }
+
+    return true;
+}
+
+// parent의 index번째 child와 그 앞의 separator를 제거
+template <typename T>
+void SetBTree<T>::RemoveChild(Internal* parent, int index)
+{
+    const int count = parent->count_;
+
+    parent->child_sizes_[index - 1] += parent->child_sizes_[index];
+
+    std::copy(parent->keys_ + index, parent->keys_ + count, parent->keys_ + index - 1);
+    std::copy(parent->children_ + index + 1, parent->children_ + count + 1,
+        parent->children_ + index);
+    std::copy(parent->child_sizes_ + index + 1, parent->child_sizes_ + count + 1,
+        parent->child_sizes_ + index);
+
+    parent->count_--;
+    Internal::KeySearch::FillPadding(parent->keys_, parent->count_);
+}
+
+// parent의 index번째 child의 key 개수가 최소보다 적으면 이웃 child에서 빌리거나 합침
+template <typename T>
+void SetBTree<T>::FixUnderflow(Internal* parent, int index)
+{
+    Node* left = (index > 0) ? parent->children_[index - 1] : nullptr;
+    Node* right = (index < parent->count_) ? parent->children_[index + 1] : nullptr;
+
+    if (parent->children_[index]->is_leaf_)
+    {
+        Leaf* child = static_cast<Leaf*>(parent->children_[index]);
+        Leaf* left_leaf = static_cast<Leaf*>(left);
+        Leaf* right_leaf = static_cast<Leaf*>(right);
+
+        if (left_leaf != nullptr && left_leaf->count_ > kMinLeafCount)
+        {
+            // 왼쪽 leaf의 최댓값을 가져옴
+            std::copy_backward(child->keys_, child->keys_ + child->count_,
+                child->keys_ + child->count_ + 1);
+            child->keys_[0] = left_leaf->keys_[left_leaf->count_ - 1];
+            child->count_++;
+
+            left_leaf->count_--;
+            Leaf::KeySearch::FillPadding(left_leaf->keys_, left_leaf->count_);
+
+            parent->keys_[index - 1] = left_leaf->keys_[left_leaf->count_ - 1];
+            parent->child_sizes_[index - 1]--;
+            parent->child_sizes_[index]++;
+            return;
+        }
+
+        if (right_leaf != nullptr && right_leaf->count_ > kMinLeafCount)
+        {
+            // 오른쪽 leaf의 최솟값을 가져옴
+            child->keys_[child->count_] = right_leaf->keys_[0];
+            child->count_++;
+
+            std::copy(right_leaf->keys_ + 1, right_leaf->keys_ + right_leaf->count_,
+                right_leaf->keys_);
+            right_leaf->count_--;
+            Leaf::KeySearch::FillPadding(right_leaf->keys_, right_leaf->count_);
+
+            parent->keys_[index] = child->keys_[child->count_ - 1];
+            parent->child_sizes_[index]++;
+            parent->child_sizes_[index + 1]--;
+            return;
+        }
+
+        // 빌릴 수 없으면 왼쪽 leaf로 합침 (왼쪽이 없으면 오른쪽 leaf를 합침)
+        Leaf* destination = (left_leaf != nullptr) ? left_leaf : child;
+        Leaf* source = (left_leaf != nullptr) ? child : right_leaf;
+        int removed = (left_leaf != nullptr) ? index : index + 1;
+
+        std::copy(source->keys_, source->keys_ + source->count_,
+            destination->keys_ + destination->count_);
+        destination->count_ += source->count_;
+
+        destination->next_ = source->next_;
+
+        if (source->next_ != nullptr)
+        {
+            source->next_->prev_ = destination;
+        }
+
+        delete source;
+        RemoveChild(parent, removed);
+        return;
+    }
+
+    Internal* child = static_cast<Internal*>(parent->children_[index]);
+    Internal* left_internal = static_cast<Internal*>(left);
+    Internal* right_internal = static_cast<Internal*>(right);
+
+    if (left_internal != nullptr && left_internal->count_ > kMinInternalCount)
+    {
+        // 왼쪽 node의 마지막 child를 가져오고 separator를 회전
+        const int count = child->count_;
+        const int last = left_internal->count_;
+
+        std::copy_backward(child->keys_, child->keys_ + count, child->keys_ + count + 1);
+        std::copy_backward(child->children_, child->children_ + count + 1,
+            child->children_ + count + 2);
+        std::copy_backward(child->child_sizes_, child->child_sizes_ + count + 1,
+            child->child_sizes_ + count + 2);
+
+        child->keys_[0] = parent->keys_[index - 1];
+        child->children_[0] = left_internal->children_[last];
+        child->child_sizes_[0] = left_internal->child_sizes_[last];
+        child->count_++;
+
+        parent->keys_[index - 1] = left_internal->keys_[last - 1];
+        parent->child_sizes_[index - 1] -= child->child_sizes_[0];
+        parent->child_sizes_[index] += child->child_sizes_[0];
+
+        left_internal->count_--;
+        Internal::KeySearch::FillPadding(left_internal->keys_, left_internal->count_);
+        return;
+    }
+
+    if (right_internal != nullptr && right_internal->count_ > kMinInternalCount)
+    {
+        // 오른쪽 node의 첫 child를 가져오고 separator를 회전
+        const int count = child->count_;
+        const int moved = right_internal->child_sizes_[0];
+
+        child->keys_[count] = parent->keys_[index];
+        child->children_[count + 1] = right_internal->children_[0];
+        child->child_sizes_[count + 1] = moved;
+        child->count_++;
+
+        parent->keys_[index] = right_internal->keys_[0];
+        parent->child_sizes_[index] += moved;
+        parent->child_sizes_[index + 1] -= moved;
+
+        const int right_count = right_internal->count_;
+
+        std::copy(right_internal->keys_ + 1, right_internal->keys_ + right_count,
+            right_internal->keys_);
+        std::copy(right_internal->children_ + 1, right_internal->children_ + right_count + 1,
+            right_internal->children_);
+        std::copy(right_internal->child_sizes_ + 1, right_internal->child_sizes_ + right_count + 1,
+            right_internal->child_sizes_);
+
+        right_internal->count_--;
+        Internal::KeySearch::FillPadding(right_internal->keys_, right_internal->count_);
+        return;
+    }
+
+    // 빌릴 수 없으면 parent의 separator와 함께 왼쪽 node로 합침 (왼쪽이 없으면 오른쪽 node를 합침)
+    Internal* destination = (left_internal != nullptr) ? left_internal : child;
+    Internal* source = (left_internal != nullptr) ? child : right_internal;
+    int removed = (left_internal != nullptr) ? index : index + 1;
+    const int count = destination->count_;
+
+    destination->keys_[count] = parent->keys_[removed - 1];
+    std::copy(source->keys_, source->keys_ + source->count_, destination->keys_ + count + 1);
+    std::copy(source->children_, source->children_ + source->count_ + 1,
+        destination->children_ + count + 1);
+    std::copy(source->child_sizes_, source->child_sizes_ + source->count_ + 1,
+        destination->child_sizes_ + count + 1);
+    destination->count_ += source->count_ + 1;
+
+    delete source;
+    RemoveChild(parent, removed);
+}
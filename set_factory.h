@@ -0,0 +1,58 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_FACTORY_H
+#define SET_FACTORY_H
+
+#include "set.h"
+#include "set_avl.h"
+#include "set_y_fast_trie.h"
+
+#include <memory>
+#include <type_traits>
+
+namespace set_factory_detail
+{
+// SetYFastTrie의 Find가 SetAVL보다 빨라지는 원소의 개수 (random 32bit key 기준 약 2e5 ~ 3e5)
+constexpr int kYFastTrieMinimumSize = 1 << 18;
+
+// 정수 key이고 원소가 충분히 많을 것으로 예상되면 SetYFastTrie 사용
+template <typename T>
+std::unique_ptr<Set<T>> MakeSet(int expected_size, std::true_type)
+{
+    if (expected_size >= kYFastTrieMinimumSize)
+    {
+        return std::unique_ptr<Set<T>>(new SetYFastTrie<T>());
+    }
+
+    return std::unique_ptr<Set<T>>(new SetAVL<T>());
+}
+
+// 그 외의 key는 SetAVL 사용
+template <typename T>
+std::unique_ptr<Set<T>> MakeSet(int, std::false_type)
+{
+    return std::unique_ptr<Set<T>>(new SetAVL<T>());
+}
+}
+
+// key의 type과 예상되는 원소의 개수에 맞는 Set 구현을 만들어 return
+// 정수 key이고 expected_size가 kYFastTrieMinimumSize 이상이면 SetYFastTrie,
+// 그 외에는 SetAVL (bool은 정수로 취급하지 않음)
+// 원소가 적으면 SetAVL의 Find가 더 빠르므로 expected_size를 생략하면 SetAVL을 사용함
+template <typename T>
+std::unique_ptr<Set<T>> MakeSet(int expected_size = 0)
+{
+    return set_factory_detail::MakeSet<T>(expected_size, std::integral_constant<bool,
+        std::is_integral<T>::value && !std::is_same<T, bool>::value>());
+}
+
+#endif
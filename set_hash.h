@@ -0,0 +1,42 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_HASH_H
+#define SET_HASH_H
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+// BlockedBloomFilter, NodeHashIndex가 사용하는 key의 64bit hash
+// std::hash의 결과를 splitmix64의 마지막 단계로 섞어서 64bit 전체에 고르게 퍼뜨림
+// (정수의 std::hash는 항등 함수이므로 그대로 쓰면 상위 bit가 모두 0)
+template <typename T>
+typename std::enable_if<std::is_default_constructible<std::hash<T>>::value, std::uint64_t>::type
+SetHashKey(const T& key)
+{
+    std::uint64_t hash = static_cast<std::uint64_t>(std::hash<T>()(key));
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+
+    return hash ^ (hash >> 31);
+}
+
+// std::hash가 없는 key는 모두 같은 hash를 가짐
+// (SetAVL은 이런 key에 대해 filter와 hash index를 켜지 못하게 막음)
+template <typename T>
+typename std::enable_if<!std::is_default_constructible<std::hash<T>>::value, std::uint64_t>::type
+SetHashKey(const T&)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,104 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_HYBRID_AVL_H
+#define SET_HYBRID_AVL_H
+
+#include "set.h"
+#include "set_avl.h"
+
+// 원소가 적을 때는 객체 안의 정렬된 배열에 key를 저장하고
+// InlineCapacity개를 넘으면 SetAVL로 전환하는 Set
+// 배열을 사용하는 동안에는 node 할당과 pointer 탐색이 없음
+//
+// 배열을 사용하는 동안의 depth는 배열을 가운데 원소 기준으로 나눈
+// 균형 잡힌 tree(SetAVL::AssignSorted가 만드는 tree와 같은 모양)에서의 depth로 정의
+// SetAVL로 전환할 때도 같은 모양의 tree를 만들므로 depth가 그대로 유지됨
+//
+// 원소의 개수가 InlineCapacity / 2 이하로 줄어들면 다시 배열로 돌아감
+// (경계 근처에서 Insert, Erase가 반복될 때 전환이 반복되지 않도록 간격을 둠)
+template <typename T, int InlineCapacity = 16>
+class SetHybridAVL : public Set<T>
+{
+public:
+    SetHybridAVL() : inline_size_(0), is_inline_(true) {}
+
+    // Basic 기능
+    // key를 root로 하는 subtree에서 최솟값을 갖는 node의 값과 depth를 출력
+    void Minimum(const T key) override final;
+
+    // key를 root로 하는 subtree에서 최댓값을 갖는 node의 값과 depth를 출력
+    void Maximum(const T key) override final;
+
+    // Set이 비어있으면 1, 그렇지 않으면 0을 return
+    bool IsEmpty() const override final { return GetSize() == 0; }
+
+    // Set에 들어있는 원소의 개수 return
+    int GetSize() const override final
+    {
+        return is_inline_ ? inline_size_ : tree_.GetSize();
+    }
+
+    // 해당 key를 가지고 있는 node의 depth를 return
+    int Find(const T key) override final;
+
+    // key를 삽입하고 해당 node의 depth를 출력
+    int Insert(const T key) override final;
+
+    // Advanced 기능
+    // 해당 key를 가지고 있는 node의 depth와 rank를 출력
+    // rank: Set에서 해당 node보다 작은 key 값을 가진 node의 개수 + 1
+    void Rank(const T key) override final;
+
+    // 해당 key를 가지고 있는 노드를 삭제하고 해당 노드의 depth를 return
+    int Erase(const T key) override final;
+
+    // 현재 배열에 key를 저장하고 있으면 true
+    bool IsInline() const { return is_inline_; }
+private:
+    static_assert(InlineCapacity >= 2, "InlineCapacity must be at least 2");
+
+    // SetAVL에서 배열로 돌아가는 원소의 개수
+    static constexpr int kDemoteSize = InlineCapacity / 2;
+
+    // 배열에서 key보다 작은 원소의 개수 (= key 이상인 첫 원소의 index)
+    // 분기 없이 비교 결과를 더하므로 compiler가 vectorize할 수 있음
+    int CountLessThan(const T key) const;
+
+    // 원소가 count개인 배열의 index번째 원소의 depth
+    static int GetInlineDepth(int count, int index);
+
+    // key를 root로 하는 subtree에 해당하는 배열의 범위 [out_begin, out_end)를 찾음
+    // key가 없으면 false
+    bool FindInlineSubtree(const T key, int& out_begin, int& out_end) const;
+
+    // 배열의 원소로 SetAVL을 만들고 SetAVL을 사용하도록 전환
+    void Promote();
+
+    // SetAVL의 원소를 배열로 옮기고 배열을 사용하도록 전환
+    void Demote();
+
+    // 배열을 사용하는 동안의 원소 (오름차순)
+    T inline_keys_[InlineCapacity];
+
+    // 배열에 들어있는 원소의 개수
+    int inline_size_;
+
+    // 배열을 사용하고 있는지 여부
+    bool is_inline_;
+
+    // 원소가 많을 때 사용하는 SetAVL
+    SetAVL<T> tree_;
+};
+
+#include "set_hybrid_avl.hpp"
+
+#endif
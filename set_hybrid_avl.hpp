@@ -0,0 +1,280 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "set_hybrid_avl.h"
+
+#include <iostream>
+
+// key를 root로 하는 subtree에서 최솟값을 갖는 node의 값과 depth를 출력
+template <typename T, int InlineCapacity>
+void SetHybridAVL<T, InlineCapacity>::Minimum(const T key)
+{
+    if (!is_inline_)
+    {
+        tree_.Minimum(key);
+        return;
+    }
+
+    int begin = 0;
+    int end = 0;
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (!FindInlineSubtree(key, begin, end))
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    std::cout << inline_keys_[begin] << " " << GetInlineDepth(inline_size_, begin) << "\n";
+}
+
+// key를 root로 하는 subtree에서 최댓값을 갖는 node의 값과 depth를 출력
+template <typename T, int InlineCapacity>
+void SetHybridAVL<T, InlineCapacity>::Maximum(const T key)
+{
+    if (!is_inline_)
+    {
+        tree_.Maximum(key);
+        return;
+    }
+
+    int begin = 0;
+    int end = 0;
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (!FindInlineSubtree(key, begin, end))
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    std::cout << inline_keys_[end - 1] << " " << GetInlineDepth(inline_size_, end - 1) << "\n";
+}
+
+// 해당 key를 가지고 있는 node의 depth를 return
+template <typename T, int InlineCapacity>
+int SetHybridAVL<T, InlineCapacity>::Find(const T key)
+{
+    if (!is_inline_)
+    {
+        return tree_.Find(key);
+    }
+
+    int index = CountLessThan(key);
+
+    if (index == inline_size_ || !(inline_keys_[index] == key))
+    {
+        return -1;
+    }
+
+    return GetInlineDepth(inline_size_, index);
+}
+
+// key를 삽입하고 해당 node의 depth를 출력
+template <typename T, int InlineCapacity>
+int SetHybridAVL<T, InlineCapacity>::Insert(const T key)
+{
+    if (!is_inline_)
+    {
+        return tree_.Insert(key);
+    }
+
+    int index = CountLessThan(key);
+
+    if (index < inline_size_ && inline_keys_[index] == key)
+    {
+        // 삽입하려고 하는 원소가 이미 Set에 들어있음
+        return -1;
+    }
+
+    if (inline_size_ == InlineCapacity)
+    {
+        // 배열이 가득 찼으므로 SetAVL로 전환한 뒤 삽입
+        Promote();
+        return tree_.Insert(key);
+    }
+
+    // index 뒤의 원소를 한 칸씩 밀고 삽입
+    for (int i = inline_size_; i > index; i--)
+    {
+        inline_keys_[i] = inline_keys_[i - 1];
+    }
+
+    inline_keys_[index] = key;
+    inline_size_++;
+
+    return GetInlineDepth(inline_size_, index);
+}
+
+// 해당 key를 가지고 있는 node의 depth와 rank를 출력
+template <typename T, int InlineCapacity>
+void SetHybridAVL<T, InlineCapacity>::Rank(const T key)
+{
+    if (!is_inline_)
+    {
+        tree_.Rank(key);
+        return;
+    }
+
+    // 배열의 index가 key보다 작은 원소의 개수
+    int index = CountLessThan(key);
+
+    if (index == inline_size_ || !(inline_keys_[index] == key))
+        std::cout << "0\n";
+    else
+        std::cout << GetInlineDepth(inline_size_, index) << " " << index + 1;
+}
+
+// 해당 key를 가지고 있는 노드를 삭제하고 해당 노드의 depth를 return
+template <typename T, int InlineCapacity>
+int SetHybridAVL<T, InlineCapacity>::Erase(const T key)
+{
+    if (!is_inline_)
+    {
+        int depth = tree_.Erase(key);
+
+        if (depth != -1 && tree_.GetSize() <= kDemoteSize)
+        {
+            Demote();
+        }
+
+        return depth;
+    }
+
+    int index = CountLessThan(key);
+
+    if (index == inline_size_ || !(inline_keys_[index] == key))
+    {
+        // 삭제하려고 하는 원소를 찾지 못함
+        return -1;
+    }
+
+    int depth = GetInlineDepth(inline_size_, index);
+
+    // index 뒤의 원소를 한 칸씩 당김
+    for (int i = index + 1; i < inline_size_; i++)
+    {
+        inline_keys_[i - 1] = inline_keys_[i];
+    }
+
+    inline_size_--;
+
+    return depth;
+}
+
+// 배열에서 key보다 작은 원소의 개수
+template <typename T, int InlineCapacity>
+int SetHybridAVL<T, InlineCapacity>::CountLessThan(const T key) const
+{
+    int count = 0;
+
+    for (int i = 0; i < inline_size_; i++)
+    {
+        count += (inline_keys_[i] < key) ? 1 : 0;
+    }
+
+    return count;
+}
+
+// 원소가 count개인 배열의 index번째 원소의 depth
+// 각 subtree의 root는 범위의 왼쪽에서 (원소의 개수 / 2)번째 원소
+// 가능한 (count, index) 조합이 적으므로 처음 호출할 때 표를 만들어두고 사용
+template <typename T, int InlineCapacity>
+int SetHybridAVL<T, InlineCapacity>::GetInlineDepth(int count, int index)
+{
+    struct DepthTable
+    {
+        DepthTable()
+        {
+            for (int size = 1; size <= InlineCapacity; size++)
+            {
+                Fill(size, 0, size, 0);
+            }
+        }
+
+        // 원소가 size개인 배열에서 [begin, begin + count) 범위의 depth를 채움
+        void Fill(int size, int begin, int count, int depth)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            int middle = begin + count / 2;
+            depth_[size][middle] = static_cast<unsigned char>(depth);
+            Fill(size, begin, count / 2, depth + 1);
+            Fill(size, middle + 1, count - count / 2 - 1, depth + 1);
+        }
+
+        unsigned char depth_[InlineCapacity + 1][InlineCapacity];
+    };
+
+    static const DepthTable table;
+
+    return table.depth_[count][index];
+}
+
+// key를 root로 하는 subtree에 해당하는 배열의 범위를 찾음
+template <typename T, int InlineCapacity>
+bool SetHybridAVL<T, InlineCapacity>::FindInlineSubtree(
+    const T key, int& out_begin, int& out_end) const
+{
+    int begin = 0;
+    int count = inline_size_;
+
+    while (count > 0)
+    {
+        int middle = begin + count / 2;
+
+        if (key == inline_keys_[middle])
+        {
+            out_begin = begin;
+            out_end = begin + count;
+            return true;
+        }
+        else if (key < inline_keys_[middle])
+        {
+            count = count / 2;
+        }
+        else
+        {
+            count = count - count / 2 - 1;
+            begin = middle + 1;
+        }
+    }
+
+    return false;
+}
+
+// 배열의 원소로 SetAVL을 만들고 SetAVL을 사용하도록 전환
+template <typename T, int InlineCapacity>
+void SetHybridAVL<T, InlineCapacity>::Promote()
+{
+    tree_.AssignSorted(inline_keys_, inline_keys_ + inline_size_);
+    inline_size_ = 0;
+    is_inline_ = false;
+}
+
+// SetAVL의 원소를 배열로 옮기고 배열을 사용하도록 전환
+template <typename T, int InlineCapacity>
+void SetHybridAVL<T, InlineCapacity>::Demote()
+{
+    T key;
+    inline_size_ = 0;
+
+    // 최솟값부터 꺼내므로 배열은 오름차순이 됨
+    while (tree_.PopMin(key))
+    {
+        inline_keys_[inline_size_++] = key;
+    }
+
+    is_inline_ = true;
+}
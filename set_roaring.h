@@ -0,0 +1,206 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_ROARING_H
+#define SET_ROARING_H
+
+#include "set.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 상위 16bit가 같은 key 2^16개를 압축해서 저장하는 container (Roaring bitmap의 container)
+// 원소의 개수와 분포에 따라 세 가지 형식 중 하나를 사용함
+//   array  : 하위 16bit 값을 오름차순으로 저장 (원소가 4096개 이하, 원소당 2byte)
+//   bitmap : 2^16bit(8KB)의 bitmap (원소가 4096개를 넘는 경우)
+//   run    : 연속된 값의 구간 (시작 값, 길이 - 1)의 목록 (Optimize에서만 만들어짐)
+// array와 bitmap은 원소의 개수에 따라 자동으로 전환되며,
+// run 형식의 container를 수정하면 array 또는 bitmap으로 풀어서 수정함
+class RoaringContainer
+{
+public:
+    enum Type
+    {
+        kArray,
+        kBitmap,
+        kRun
+    };
+
+    RoaringContainer() : type_(kArray), cardinality_(0) {}
+
+    Type GetType() const { return type_; }
+    int GetCardinality() const { return cardinality_; }
+
+    // value가 들어있으면 true
+    bool Contains(std::uint16_t value) const;
+
+    // value를 추가 (이미 있으면 false)
+    bool Add(std::uint16_t value);
+
+    // value를 삭제 (없으면 false)
+    bool Remove(std::uint16_t value);
+
+    // value보다 작은 원소의 개수 (bitmap은 popcount로 계산)
+    int CountLessThan(std::uint16_t value) const;
+
+    // 최솟값, 최댓값 (비어있지 않은 경우에만 호출)
+    std::uint16_t GetMinimum() const;
+    std::uint16_t GetMaximum() const;
+
+    // array, bitmap, run 중 메모리를 가장 적게 사용하는 형식으로 전환
+    void Optimize();
+
+    // container가 사용하는 heap 메모리 (byte)
+    std::size_t GetMemoryBytes() const;
+
+    // 두 container의 교집합, 합집합
+    // bitmap끼리는 64bit word 단위로 계산하므로 compiler가 vectorize할 수 있음
+    static RoaringContainer Intersect(const RoaringContainer& left, const RoaringContainer& right);
+    static RoaringContainer Union(const RoaringContainer& left, const RoaringContainer& right);
+private:
+    // 연속된 값의 구간 [start, start + length]
+    struct Run
+    {
+        std::uint16_t start;
+        std::uint16_t length;
+    };
+
+    // array 형식으로 저장할 수 있는 최대 원소의 개수
+    static constexpr int kArrayMaxCardinality = 4096;
+
+    // bitmap의 64bit word 개수
+    static constexpr int kBitmapWordCount = (1 << 16) / 64;
+
+    // 원소의 개수에 맞게 array 또는 bitmap 형식으로 전환
+    void ConvertToArray();
+    void ConvertToBitmap();
+
+    // run 형식을 원소의 개수에 맞게 array 또는 bitmap으로 풂
+    void Decompress();
+
+    // run 형식으로 저장했을 때 필요한 run의 개수
+    int CountRuns() const;
+
+    // bitmap의 원소 개수를 다시 계산
+    static int CountBits(const std::vector<std::uint64_t>& bitmap);
+
+    // container의 형식
+    Type type_;
+
+    // 원소의 개수
+    int cardinality_;
+
+    // array 형식의 원소 (오름차순)
+    std::vector<std::uint16_t> array_;
+
+    // bitmap 형식의 원소
+    std::vector<std::uint64_t> bitmap_;
+
+    // run 형식의 원소 (start의 오름차순)
+    std::vector<Run> runs_;
+};
+
+// 32bit 정수 key를 상위 16bit로 나누어 RoaringContainer에 저장하는 Set
+// 빽빽하거나 일부 구간에 몰려 있는 key를 SetAVL보다 훨씬 적은 메모리로 저장함
+//
+// container는 만들어진 순서대로 저장하고, 상위 16bit로 container를 찾는 index는
+// 256개의 block(각 block은 256개의 칸)으로 나누어 사용하는 block만 할당함
+// 따라서 container를 찾거나 새로 만드는 비용이 container의 개수와 관계없이 일정함
+//
+// tree가 아니므로 depth는 다음과 같이 정의함
+//   container 목록을 depth 0으로 보고, 모든 key는 container 안에 있으므로 depth는 1
+// Minimum, Maximum은 key가 들어있는 container를 key의 subtree로 봄
+class SetRoaring : public Set<int>
+{
+public:
+    SetRoaring() : size_(0), block_cardinality_(kBlockCount, 0), index_blocks_(kBlockCount) {}
+
+    // Basic 기능
+    // key가 들어있는 container에서 최솟값과 depth를 출력
+    void Minimum(const int key) override final;
+
+    // key가 들어있는 container에서 최댓값과 depth를 출력
+    void Maximum(const int key) override final;
+
+    // Set이 비어있으면 1, 그렇지 않으면 0을 return
+    bool IsEmpty() const override final { return size_ == 0; }
+
+    // Set에 들어있는 원소의 개수 return
+    int GetSize() const override final { return size_; }
+
+    // 해당 key의 depth를 return (없으면 -1)
+    int Find(const int key) override final;
+
+    // key를 삽입하고 depth를 return (이미 있으면 -1)
+    int Insert(const int key) override final;
+
+    // Advanced 기능
+    // 해당 key의 depth와 rank를 출력
+    // rank: Set에서 해당 key보다 작은 key의 개수 + 1
+    void Rank(const int key) override final;
+
+    // 해당 key를 삭제하고 depth를 return (없으면 -1)
+    int Erase(const int key) override final;
+
+    // key가 Set에 들어있으면 true
+    bool Contains(const int key) const;
+
+    // 모든 container를 메모리를 가장 적게 사용하는 형식으로 전환
+    void Optimize();
+
+    // Set이 사용하는 heap 메모리 (byte)
+    std::size_t GetMemoryBytes() const;
+
+    // 형식별 container의 개수
+    void CountContainers(int& out_array, int& out_bitmap, int& out_run) const;
+
+    // 두 Set의 교집합, 합집합
+    static SetRoaring Intersect(const SetRoaring& left, const SetRoaring& right);
+    static SetRoaring Union(const SetRoaring& left, const SetRoaring& right);
+private:
+    // index block의 개수와 block 하나의 칸 수 (상위 16bit의 상위 8bit, 하위 8bit)
+    static constexpr int kBlockCount = 256;
+    static constexpr int kBlockSize = 256;
+
+    // key를 순서가 유지되는 unsigned 값으로 바꿨을 때의 상위 16bit, 하위 16bit
+    static std::uint16_t GetHighBits(const int key);
+    static std::uint16_t GetLowBits(const int key);
+
+    // 상위 16bit와 하위 16bit로 key를 만듦
+    static int MakeKey(std::uint16_t high_bits, std::uint16_t low_bits);
+
+    // high_bits에 해당하는 container의 index (없으면 -1)
+    int FindContainer(std::uint16_t high_bits) const;
+
+    // high_bits에 해당하는 container를 만들고 index를 return
+    int CreateContainer(std::uint16_t high_bits, RoaringContainer container);
+
+    // index번째 container를 제거 (마지막 container를 그 자리로 옮김)
+    void RemoveContainer(int index);
+
+    // Set에 들어있는 원소의 개수
+    int size_;
+
+    // 만들어진 순서대로 저장한 container와 container의 상위 16bit
+    std::vector<RoaringContainer> containers_;
+    std::vector<std::uint16_t> high_bits_;
+
+    // block별 원소의 개수 (Rank 계산에 사용)
+    std::vector<int> block_cardinality_;
+
+    // 상위 16bit로 container의 index를 찾는 표 (사용하지 않는 block은 비어있음, 없는 칸은 -1)
+    std::vector<std::vector<int>> index_blocks_;
+};
+
+#include "set_roaring.hpp"
+
+#endif
@@ -0,0 +1,872 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "set_roaring.h"
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+
+// value가 들어있으면 true
+inline bool RoaringContainer::Contains(std::uint16_t value) const
+{
+    switch (type_)
+    {
+    case kArray:
+        return std::binary_search(array_.begin(), array_.end(), value);
+    case kBitmap:
+        return (bitmap_[value >> 6] >> (value & 63)) & 1;
+    default:
+    {
+        // value 이하에서 시작하는 마지막 run
+        auto it = std::upper_bound(runs_.begin(), runs_.end(), value,
+            [](std::uint16_t target, const Run& run) { return target < run.start; });
+
+        if (it == runs_.begin())
+        {
+            return false;
+        }
+
+        --it;
+        return value - it->start <= it->length;
+    }
+    }
+}
+
+// value를 추가
+inline bool RoaringContainer::Add(std::uint16_t value)
+{
+    if (type_ == kRun)
+    {
+        if (Contains(value))
+        {
+            return false;
+        }
+
+        Decompress();
+    }
+
+    if (type_ == kArray)
+    {
+        auto it = std::lower_bound(array_.begin(), array_.end(), value);
+
+        if (it != array_.end() && *it == value)
+        {
+            return false;
+        }
+
+        if (cardinality_ < kArrayMaxCardinality)
+        {
+            array_.insert(it, value);
+            cardinality_++;
+            return true;
+        }
+
+        // array가 가득 찼으므로 bitmap으로 전환한 뒤 추가
+        ConvertToBitmap();
+    }
+
+    std::uint64_t& word = bitmap_[value >> 6];
+    const std::uint64_t bit = std::uint64_t(1) << (value & 63);
+
+    if (word & bit)
+    {
+        return false;
+    }
+
+    word |= bit;
+    cardinality_++;
+
+    return true;
+}
+
+// value를 삭제
+inline bool RoaringContainer::Remove(std::uint16_t value)
+{
+    if (type_ == kRun)
+    {
+        if (!Contains(value))
+        {
+            return false;
+        }
+
+        Decompress();
+    }
+
+    if (type_ == kArray)
+    {
+        auto it = std::lower_bound(array_.begin(), array_.end(), value);
+
+        if (it == array_.end() || *it != value)
+        {
+            return false;
+        }
+
+        array_.erase(it);
+        cardinality_--;
+        return true;
+    }
+
+    std::uint64_t& word = bitmap_[value >> 6];
+    const std::uint64_t bit = std::uint64_t(1) << (value & 63);
+
+    if (!(word & bit))
+    {
+        return false;
+    }
+
+    word &= ~bit;
+    cardinality_--;
+
+    if (cardinality_ <= kArrayMaxCardinality)
+    {
+        // 원소가 적어졌으므로 array로 전환
+        ConvertToArray();
+    }
+
+    return true;
+}
+
+// value보다 작은 원소의 개수
+inline int RoaringContainer::CountLessThan(std::uint16_t value) const
+{
+    switch (type_)
+    {
+    case kArray:
+        return static_cast<int>(
+            std::lower_bound(array_.begin(), array_.end(), value) - array_.begin());
+    case kBitmap:
+    {
+        // value가 속한 word 앞의 word는 popcount로 세고, 해당 word는 mask를 씌워서 셈
+        const int word_index = value >> 6;
+        int count = 0;
+
+        for (int i = 0; i < word_index; i++)
+        {
+            count += __builtin_popcountll(bitmap_[i]);
+        }
+
+        const std::uint64_t mask = (std::uint64_t(1) << (value & 63)) - 1;
+        return count + __builtin_popcountll(bitmap_[word_index] & mask);
+    }
+    default:
+    {
+        int count = 0;
+
+        for (const Run& run : runs_)
+        {
+            if (value <= run.start)
+            {
+                break;
+            }
+
+            count += std::min(value - run.start, run.length + 1);
+        }
+
+        return count;
+    }
+    }
+}
+
+// 최솟값
+inline std::uint16_t RoaringContainer::GetMinimum() const
+{
+    switch (type_)
+    {
+    case kArray:
+        return array_.front();
+    case kBitmap:
+    {
+        int i = 0;
+
+        while (bitmap_[i] == 0)
+        {
+            i++;
+        }
+
+        return static_cast<std::uint16_t>(i * 64 + __builtin_ctzll(bitmap_[i]));
+    }
+    default:
+        return runs_.front().start;
+    }
+}
+
+// 최댓값
+inline std::uint16_t RoaringContainer::GetMaximum() const
+{
+    switch (type_)
+    {
+    case kArray:
+        return array_.back();
+    case kBitmap:
+    {
+        int i = kBitmapWordCount - 1;
+
+        while (bitmap_[i] == 0)
+        {
+            i--;
+        }
+
+        return static_cast<std::uint16_t>(i * 64 + 63 - __builtin_clzll(bitmap_[i]));
+    }
+    default:
+        return static_cast<std::uint16_t>(runs_.back().start + runs_.back().length);
+    }
+}
+
+// array, bitmap, run 중 메모리를 가장 적게 사용하는 형식으로 전환
+inline void RoaringContainer::Optimize()
+{
+    if (type_ == kRun)
+    {
+        Decompress();
+    }
+
+    const std::size_t run_bytes = static_cast<std::size_t>(CountRuns()) * sizeof(Run);
+    const std::size_t current_bytes = (type_ == kArray)
+        ? static_cast<std::size_t>(cardinality_) * sizeof(std::uint16_t)
+        : kBitmapWordCount * sizeof(std::uint64_t);
+
+    if (run_bytes < current_bytes)
+    {
+        // 연속된 값의 구간을 모아서 run 형식으로 전환
+        std::vector<Run> runs;
+        runs.reserve(CountRuns());
+
+        int value = 0;
+
+        while (value < (1 << 16))
+        {
+            if (!Contains(static_cast<std::uint16_t>(value)))
+            {
+                // 다음 원소까지 건너뜀
+                if (type_ == kBitmap && (value & 63) == 0 && bitmap_[value >> 6] == 0)
+                {
+                    value += 64;
+                }
+                else if (type_ == kArray)
+                {
+                    auto it = std::lower_bound(
+                        array_.begin(), array_.end(), static_cast<std::uint16_t>(value));
+
+                    if (it == array_.end())
+                    {
+                        break;
+                    }
+
+                    value = *it;
+                }
+                else
+                {
+                    value++;
+                }
+
+                continue;
+            }
+
+            int end = value;
+
+            while (end + 1 < (1 << 16) && Contains(static_cast<std::uint16_t>(end + 1)))
+            {
+                end++;
+            }
+
+            runs.push_back({ static_cast<std::uint16_t>(value),
+                static_cast<std::uint16_t>(end - value) });
+            value = end + 1;
+        }
+
+        runs_.swap(runs);
+        std::vector<std::uint16_t>().swap(array_);
+        std::vector<std::uint64_t>().swap(bitmap_);
+        type_ = kRun;
+    }
+    else if (type_ == kArray)
+    {
+        array_.shrink_to_fit();
+    }
+}
+
+// container가 사용하는 heap 메모리
+inline std::size_t RoaringContainer::GetMemoryBytes() const
+{
+    return array_.capacity() * sizeof(std::uint16_t)
+        + bitmap_.capacity() * sizeof(std::uint64_t)
+        + runs_.capacity() * sizeof(Run);
+}
+
+// 두 container의 교집합
+inline RoaringContainer RoaringContainer::Intersect(
+    const RoaringContainer& left, const RoaringContainer& right)
+{
+    // run 형식은 풀어서 계산
+    if (left.type_ == kRun || right.type_ == kRun)
+    {
+        RoaringContainer left_copy = left;
+        RoaringContainer right_copy = right;
+
+        if (left_copy.type_ == kRun)
+        {
+            left_copy.Decompress();
+        }
+
+        if (right_copy.type_ == kRun)
+        {
+            right_copy.Decompress();
+        }
+
+        return Intersect(left_copy, right_copy);
+    }
+
+    RoaringContainer result;
+
+    if (left.type_ == kBitmap && right.type_ == kBitmap)
+    {
+        result.bitmap_.resize(kBitmapWordCount);
+
+        for (int i = 0; i < kBitmapWordCount; i++)
+        {
+            result.bitmap_[i] = left.bitmap_[i] & right.bitmap_[i];
+        }
+
+        result.type_ = kBitmap;
+        result.cardinality_ = CountBits(result.bitmap_);
+
+        if (result.cardinality_ <= kArrayMaxCardinality)
+        {
+            result.ConvertToArray();
+        }
+    }
+    else if (left.type_ == kArray && right.type_ == kArray)
+    {
+        std::set_intersection(left.array_.begin(), left.array_.end(),
+            right.array_.begin(), right.array_.end(), std::back_inserter(result.array_));
+        result.cardinality_ = static_cast<int>(result.array_.size());
+    }
+    else
+    {
+        // array의 각 원소가 bitmap에 있는지 확인
+        const RoaringContainer& array_container = (left.type_ == kArray) ? left : right;
+        const RoaringContainer& bitmap_container = (left.type_ == kArray) ? right : left;
+
+        for (std::uint16_t value : array_container.array_)
+        {
+            if (bitmap_container.Contains(value))
+            {
+                result.array_.push_back(value);
+            }
+        }
+
+        result.cardinality_ = static_cast<int>(result.array_.size());
+    }
+
+    return result;
+}
+
+// 두 container의 합집합
+inline RoaringContainer RoaringContainer::Union(
+    const RoaringContainer& left, const RoaringContainer& right)
+{
+    // run 형식은 풀어서 계산
+    if (left.type_ == kRun || right.type_ == kRun)
+    {
+        RoaringContainer left_copy = left;
+        RoaringContainer right_copy = right;
+
+        if (left_copy.type_ == kRun)
+        {
+            left_copy.Decompress();
+        }
+
+        if (right_copy.type_ == kRun)
+        {
+            right_copy.Decompress();
+        }
+
+        return Union(left_copy, right_copy);
+    }
+
+    RoaringContainer result;
+
+    if (left.type_ == kArray && right.type_ == kArray)
+    {
+        std::set_union(left.array_.begin(), left.array_.end(),
+            right.array_.begin(), right.array_.end(), std::back_inserter(result.array_));
+        result.cardinality_ = static_cast<int>(result.array_.size());
+
+        if (result.cardinality_ > kArrayMaxCardinality)
+        {
+            result.ConvertToBitmap();
+        }
+
+        return result;
+    }
+
+    if (left.type_ == kBitmap && right.type_ == kBitmap)
+    {
+        result.bitmap_.resize(kBitmapWordCount);
+
+        for (int i = 0; i < kBitmapWordCount; i++)
+        {
+            result.bitmap_[i] = left.bitmap_[i] | right.bitmap_[i];
+        }
+    }
+    else
+    {
+        // bitmap을 복사한 뒤 array의 원소를 추가
+        const RoaringContainer& array_container = (left.type_ == kArray) ? left : right;
+        const RoaringContainer& bitmap_container = (left.type_ == kArray) ? right : left;
+
+        result.bitmap_ = bitmap_container.bitmap_;
+
+        for (std::uint16_t value : array_container.array_)
+        {
+            result.bitmap_[value >> 6] |= std::uint64_t(1) << (value & 63);
+        }
+    }
+
+    result.type_ = kBitmap;
+    result.cardinality_ = CountBits(result.bitmap_);
+
+    return result;
+}
+
+// array 형식으로 전환
+inline void RoaringContainer::ConvertToArray()
+{
+    std::vector<std::uint16_t> array;
+    array.reserve(cardinality_);
+
+    for (int i = 0; i < kBitmapWordCount; i++)
+    {
+        std::uint64_t word = bitmap_[i];
+
+        while (word != 0)
+        {
+            array.push_back(static_cast<std::uint16_t>(i * 64 + __builtin_ctzll(word)));
+            word &= word - 1;
+        }
+    }
+
+    array_.swap(array);
+    std::vector<std::uint64_t>().swap(bitmap_);
+    type_ = kArray;
+}
+
+// bitmap 형식으로 전환
+inline void RoaringContainer::ConvertToBitmap()
+{
+    bitmap_.assign(kBitmapWordCount, 0);
+
+    for (std::uint16_t value : array_)
+    {
+        bitmap_[value >> 6] |= std::uint64_t(1) << (value & 63);
+    }
+
+    std::vector<std::uint16_t>().swap(array_);
+    type_ = kBitmap;
+}
+
+// run 형식을 풂
+inline void RoaringContainer::Decompress()
+{
+    std::vector<Run> runs;
+    runs.swap(runs_);
+
+    if (cardinality_ <= kArrayMaxCardinality)
+    {
+        array_.clear();
+        array_.reserve(cardinality_);
+
+        for (const Run& run : runs)
+        {
+            for (int value = run.start; value <= run.start + run.length; value++)
+            {
+                array_.push_back(static_cast<std::uint16_t>(value));
+            }
+        }
+
+        type_ = kArray;
+    }
+    else
+    {
+        bitmap_.assign(kBitmapWordCount, 0);
+
+        for (const Run& run : runs)
+        {
+            for (int value = run.start; value <= run.start + run.length; value++)
+            {
+                bitmap_[value >> 6] |= std::uint64_t(1) << (value & 63);
+            }
+        }
+
+        type_ = kBitmap;
+    }
+}
+
+// run 형식으로 저장했을 때 필요한 run의 개수
+inline int RoaringContainer::CountRuns() const
+{
+    if (type_ == kRun)
+    {
+        return static_cast<int>(runs_.size());
+    }
+
+    if (type_ == kArray)
+    {
+        int count = 0;
+
+        for (std::size_t i = 0; i < array_.size(); i++)
+        {
+            if (i == 0 || array_[i] != array_[i - 1] + 1)
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    // 1인 bit 바로 앞의 bit가 0이면 새로운 run의 시작
+    int count = 0;
+    std::uint64_t previous_top_bit = 0;
+
+    for (int i = 0; i < kBitmapWordCount; i++)
+    {
+        const std::uint64_t word = bitmap_[i];
+        const std::uint64_t previous_bits = (word << 1) | previous_top_bit;
+        count += __builtin_popcountll(word & ~previous_bits);
+        previous_top_bit = word >> 63;
+    }
+
+    return count;
+}
+
+// bitmap의 원소 개수를 다시 계산
+inline int RoaringContainer::CountBits(const std::vector<std::uint64_t>& bitmap)
+{
+    int count = 0;
+
+    for (std::uint64_t word : bitmap)
+    {
+        count += __builtin_popcountll(word);
+    }
+
+    return count;
+}
+
+// key를 순서가 유지되는 unsigned 값으로 바꿨을 때의 상위 16bit
+inline std::uint16_t SetRoaring::GetHighBits(const int key)
+{
+    return static_cast<std::uint16_t>((static_cast<std::uint32_t>(key) ^ 0x80000000u) >> 16);
+}
+
+// key를 순서가 유지되는 unsigned 값으로 바꿨을 때의 하위 16bit
+inline std::uint16_t SetRoaring::GetLowBits(const int key)
+{
+    return static_cast<std::uint16_t>(static_cast<std::uint32_t>(key) & 0xffffu);
+}
+
+// 상위 16bit와 하위 16bit로 key를 만듦
+inline int SetRoaring::MakeKey(std::uint16_t high_bits, std::uint16_t low_bits)
+{
+    return static_cast<int>(((static_cast<std::uint32_t>(high_bits) << 16) | low_bits)
+        ^ 0x80000000u);
+}
+
+// high_bits에 해당하는 container의 index
+inline int SetRoaring::FindContainer(std::uint16_t high_bits) const
+{
+    const std::vector<int>& block = index_blocks_[high_bits >> 8];
+
+    return block.empty() ? -1 : block[high_bits & 0xff];
+}
+
+// high_bits에 해당하는 container를 만들고 index를 return
+inline int SetRoaring::CreateContainer(std::uint16_t high_bits, RoaringContainer container)
+{
+    std::vector<int>& block = index_blocks_[high_bits >> 8];
+
+    if (block.empty())
+    {
+        block.assign(kBlockSize, -1);
+    }
+
+    const int index = static_cast<int>(containers_.size());
+
+    block[high_bits & 0xff] = index;
+    block_cardinality_[high_bits >> 8] += container.GetCardinality();
+    containers_.push_back(std::move(container));
+    high_bits_.push_back(high_bits);
+
+    return index;
+}
+
+// index번째 container를 제거
+inline void SetRoaring::RemoveContainer(int index)
+{
+    const std::uint16_t high_bits = high_bits_[index];
+    const int last = static_cast<int>(containers_.size()) - 1;
+
+    block_cardinality_[high_bits >> 8] -= containers_[index].GetCardinality();
+    index_blocks_[high_bits >> 8][high_bits & 0xff] = -1;
+
+    if (index != last)
+    {
+        // 마지막 container를 빈 자리로 옮기고 index를 갱신
+        containers_[index] = std::move(containers_[last]);
+        high_bits_[index] = high_bits_[last];
+        index_blocks_[high_bits_[index] >> 8][high_bits_[index] & 0xff] = index;
+    }
+
+    containers_.pop_back();
+    high_bits_.pop_back();
+}
+
+// key가 들어있는 container에서 최솟값과 depth를 출력
+inline void SetRoaring::Minimum(const int key)
+{
+    int index = FindContainer(GetHighBits(key));
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (index == -1 || !containers_[index].Contains(GetLowBits(key)))
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    std::cout << MakeKey(high_bits_[index], containers_[index].GetMinimum()) << " 1\n";
+}
+
+// key가 들어있는 container에서 최댓값과 depth를 출력
+inline void SetRoaring::Maximum(const int key)
+{
+    int index = FindContainer(GetHighBits(key));
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (index == -1 || !containers_[index].Contains(GetLowBits(key)))
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    std::cout << MakeKey(high_bits_[index], containers_[index].GetMaximum()) << " 1\n";
+}
+
+// 해당 key의 depth를 return
+inline int SetRoaring::Find(const int key)
+{
+    return Contains(key) ? 1 : -1;
+}
+
+// key가 Set에 들어있으면 true
+inline bool SetRoaring::Contains(const int key) const
+{
+    int index = FindContainer(GetHighBits(key));
+
+    return index != -1 && containers_[index].Contains(GetLowBits(key));
+}
+
+// key를 삽입하고 depth를 return
+inline int SetRoaring::Insert(const int key)
+{
+    const std::uint16_t high_bits = GetHighBits(key);
+    int index = FindContainer(high_bits);
+
+    if (index == -1)
+    {
+        // 해당 상위 16bit의 container를 새로 만듦
+        index = CreateContainer(high_bits, RoaringContainer());
+    }
+
+    if (!containers_[index].Add(GetLowBits(key)))
+    {
+        return -1;
+    }
+
+    block_cardinality_[high_bits >> 8]++;
+    size_++;
+
+    return 1;
+}
+
+// 해당 key의 depth와 rank를 출력
+inline void SetRoaring::Rank(const int key)
+{
+    const std::uint16_t high_bits = GetHighBits(key);
+    int index = FindContainer(high_bits);
+
+    if (index == -1 || !containers_[index].Contains(GetLowBits(key)))
+    {
+        std::cout << "0\n";
+        return;
+    }
+
+    // 앞의 block, 같은 block의 앞 container, container 안에서 key보다 작은 원소의 개수를 더함
+    int rank = 1;
+
+    for (int i = 0; i < (high_bits >> 8); i++)
+    {
+        rank += block_cardinality_[i];
+    }
+
+    const std::vector<int>& block = index_blocks_[high_bits >> 8];
+
+    for (int i = 0; i < (high_bits & 0xff); i++)
+    {
+        if (block[i] != -1)
+        {
+            rank += containers_[block[i]].GetCardinality();
+        }
+    }
+
+    rank += containers_[index].CountLessThan(GetLowBits(key));
+
+    std::cout << 1 << " " << rank;
+}
+
+// 해당 key를 삭제하고 depth를 return
+inline int SetRoaring::Erase(const int key)
+{
+    const std::uint16_t high_bits = GetHighBits(key);
+    int index = FindContainer(high_bits);
+
+    if (index == -1 || !containers_[index].Remove(GetLowBits(key)))
+    {
+        return -1;
+    }
+
+    block_cardinality_[high_bits >> 8]--;
+    size_--;
+
+    if (containers_[index].GetCardinality() == 0)
+    {
+        // 빈 container는 제거
+        RemoveContainer(index);
+    }
+
+    return 1;
+}
+
+// 모든 container를 메모리를 가장 적게 사용하는 형식으로 전환
+inline void SetRoaring::Optimize()
+{
+    for (RoaringContainer& container : containers_)
+    {
+        container.Optimize();
+    }
+
+    containers_.shrink_to_fit();
+    high_bits_.shrink_to_fit();
+}
+
+// Set이 사용하는 heap 메모리
+inline std::size_t SetRoaring::GetMemoryBytes() const
+{
+    std::size_t bytes = containers_.capacity() * sizeof(RoaringContainer)
+        + high_bits_.capacity() * sizeof(std::uint16_t)
+        + block_cardinality_.capacity() * sizeof(int)
+        + index_blocks_.capacity() * sizeof(std::vector<int>);
+
+    for (const std::vector<int>& block : index_blocks_)
+    {
+        bytes += block.capacity() * sizeof(int);
+    }
+
+    for (const RoaringContainer& container : containers_)
+    {
+        bytes += container.GetMemoryBytes();
+    }
+
+    return bytes;
+}
+
+// 형식별 container의 개수
+inline void SetRoaring::CountContainers(int& out_array, int& out_bitmap, int& out_run) const
+{
+    out_array = 0;
+    out_bitmap = 0;
+    out_run = 0;
+
+    for (const RoaringContainer& container : containers_)
+    {
+        switch (container.GetType())
+        {
+        case RoaringContainer::kArray:
+            out_array++;
+            break;
+        case RoaringContainer::kBitmap:
+            out_bitmap++;
+            break;
+        default:
+            out_run++;
+            break;
+        }
+    }
+}
+
+// 두 Set의 교집합
+inline SetRoaring SetRoaring::Intersect(const SetRoaring& left, const SetRoaring& right)
+{
+    SetRoaring result;
+
+    // 상위 16bit가 같은 container끼리만 교집합을 계산
+    for (std::size_t i = 0; i < left.containers_.size(); i++)
+    {
+        int index = right.FindContainer(left.high_bits_[i]);
+
+        if (index == -1)
+        {
+            continue;
+        }
+
+        RoaringContainer container = RoaringContainer::Intersect(
+            left.containers_[i], right.containers_[index]);
+
+        if (container.GetCardinality() > 0)
+        {
+            result.size_ += container.GetCardinality();
+            result.CreateContainer(left.high_bits_[i], std::move(container));
+        }
+    }
+
+    return result;
+}
+
+// 두 Set의 합집합
+inline SetRoaring SetRoaring::Union(const SetRoaring& left, const SetRoaring& right)
+{
+    // left를 복사한 뒤 right의 container를 합침
+    SetRoaring result = left;
+
+    for (std::size_t i = 0; i < right.containers_.size(); i++)
+    {
+        const std::uint16_t high_bits = right.high_bits_[i];
+        int index = result.FindContainer(high_bits);
+
+        if (index == -1)
+        {
+            result.size_ += right.containers_[i].GetCardinality();
+            result.CreateContainer(high_bits, right.containers_[i]);
+            continue;
+        }
+
+        RoaringContainer container = RoaringContainer::Union(
+            result.containers_[index], right.containers_[i]);
+        const int added = container.GetCardinality() - result.containers_[index].GetCardinality();
+
+        result.size_ += added;
+        result.block_cardinality_[high_bits >> 8] += added;
+        result.containers_[index] = std::move(container);
+    }
+
+    return result;
+}
@@ -0,0 +1,119 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_SKIP_LIST_H
+#define SET_SKIP_LIST_H
+
+#include "epoch_manager.h"
+#include "node_skip_list.h"
+#include "set.h"
+
+#include <atomic>
+#include <cstdint>
+
+// 여러 thread가 lock 없이 동시에 사용할 수 있는 skiplist Set
+// level별 연결을 CAS로 바꾸며, 삭제는 node의 다음 pointer에 표시를 남기는 것으로
+// 논리적으로 먼저 수행하고 이후 탐색하는 thread가 물리적으로 떼어냄
+// 떼어낸 node는 EpochManager를 통해 읽는 thread가 없어진 뒤 해제함
+//
+// skiplist를 tree로 보았을 때 높은 tower일수록 root에 가까우므로
+// depth는 (현재 가장 높은 tower의 높이 - node의 높이)로 정의
+// Minimum(key)은 key, Maximum(key)는 key의 tower가 덮는 범위
+// (key 뒤에서 높이가 key의 tower 이상인 첫 node 전까지)의 마지막 key를 출력
+// Rank, Minimum, Maximum은 다른 thread가 수정하는 동안 호출하면 근사값일 수 있음
+template <typename T>
+class SetSkipList : public Set<T>
+{
+public:
+    SetSkipList();
+    ~SetSkipList();
+
+    // Basic 기능
+    // key의 tower가 덮는 범위에서 최솟값을 갖는 node의 값과 depth를 출력
+    void Minimum(const T key) override final;
+
+    // key의 tower가 덮는 범위에서 최댓값을 갖는 node의 값과 depth를 출력
+    void Maximum(const T key) override final;
+
+    // Set이 비어있으면 1, 그렇지 않으면 0을 return
+    bool IsEmpty() const override final { return size_.load() == 0; }
+
+    // Set에 들어있는 원소의 개수 return
+    int GetSize() const override final { return size_.load(); }
+
+    // 해당 key의 depth를 return (없으면 -1)
+    int Find(const T key) override final;
+
+    // key를 삽입하고 depth를 return (이미 있으면 -1)
+    int Insert(const T key) override final;
+
+    // Advanced 기능
+    // 해당 key의 depth와 rank를 출력
+    // rank: Set에서 해당 key보다 작은 key의 개수 + 1 (가장 아래 level을 세므로 O(n))
+    void Rank(const T key) override final;
+
+    // 해당 key를 삭제하고 depth를 return (없으면 -1)
+    int Erase(const T key) override final;
+
+    // key가 Set에 들어있으면 true
+    bool Contains(const T key) const;
+private:
+    typedef NodeSkipList<T> Node;
+
+    // tower의 최대 높이
+    static constexpr int kMaxHeight = 24;
+
+    SetSkipList(const SetSkipList&) = delete;
+    SetSkipList& operator=(const SetSkipList&) = delete;
+
+    // 다음 pointer의 삭제 표시와 node
+    static bool IsMarked(std::uintptr_t link) { return (link & 1) != 0; }
+    static Node* GetNode(std::uintptr_t link) { return reinterpret_cast<Node*>(link & ~std::uintptr_t(1)); }
+    static std::uintptr_t MakeLink(Node* node) { return reinterpret_cast<std::uintptr_t>(node); }
+
+    // EpochManager가 node를 해제할 때 사용
+    static void DeleteNode(void* node) { delete static_cast<Node*>(node); }
+
+    // 1 이상 kMaxHeight 이하의 무작위 높이 (높이 h + 1의 확률은 높이 h의 1/2)
+    static int GetRandomHeight();
+
+    // level별로 key보다 작은 마지막 node(out_preds)와 그 다음 node(out_succs)를 찾음
+    // 지나가는 길에 삭제 표시된 node를 떼어내며, key를 가진 node가 있으면 true
+    bool FindPosition(const T& key, Node** out_preds, Node** out_succs);
+
+    // 떼어내지 않고 key를 가진 삭제되지 않은 node를 찾음 (없으면 nullptr)
+    Node* FindNode(const T& key) const;
+
+    // 삭제 표시된 node를 모든 level에서 떼어냄
+    void Unlink(Node* node);
+
+    // 삽입한 thread와 삭제한 thread가 모두 작업을 마치면 node를 떼어내고 회수기에 넘김
+    void Release(Node* node);
+
+    // node의 depth
+    int GetDepth(const Node* node) const { return height_.load() - node->height_; }
+
+    // key를 갖지 않는 시작 node
+    Node* head_;
+
+    // Set에 들어있는 원소의 개수
+    std::atomic<int> size_;
+
+    // 지금까지 삽입된 tower 중 가장 높은 높이 (node를 가장 아래 level에 연결하기 전에 올림)
+    std::atomic<int> height_;
+
+    // 떼어낸 node의 회수기
+    mutable EpochManager epoch_manager_;
+};
+
+#include "set_skip_list.hpp"
+
+#endif
@@ -0,0 +1,444 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "set_skip_list.h"
+
+#include <iostream>
+#include <random>
+
+template <typename T>
+SetSkipList<T>::SetSkipList() : head_(new Node(T(), kMaxHeight)), size_(0), height_(1) {}
+
+// 다른 thread가 사용하지 않을 때 소멸되어야 함
+template <typename T>
+SetSkipList<T>::~SetSkipList()
+{
+    // 가장 아래 level에 연결된 node는 아직 회수기에 넘기지 않은 node
+    Node* node = head_;
+
+    while (node != nullptr)
+    {
+        Node* next = GetNode(node->next_[0].load());
+        delete node;
+        node = next;
+    }
+}
+
+// key의 tower가 덮는 범위에서 최솟값을 갖는 node의 값과 depth를 출력
+template <typename T>
+void SetSkipList<T>::Minimum(const T key)
+{
+    EpochManager::Guard guard(epoch_manager_);
+    const Node* node = FindNode(key);
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (node == nullptr)
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    std::cout << node->key_ << " " << GetDepth(node) << "\n";
+}
+
+// key의 tower가 덮는 범위에서 최댓값을 갖는 node의 값과 depth를 출력
+template <typename T>
+void SetSkipList<T>::Maximum(const T key)
+{
+    EpochManager::Guard guard(epoch_manager_);
+    const Node* node = FindNode(key);
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (node == nullptr)
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    // 높이가 node 이상인 다음 node 직전까지 가장 아래 level을 따라감
+    const Node* last = node;
+    const Node* current = GetNode(node->next_[0].load());
+
+    while (current != nullptr && current->height_ < node->height_)
+    {
+        if (!IsMarked(current->next_[0].load()))
+        {
+            last = current;
+        }
+
+        current = GetNode(current->next_[0].load());
+    }
+
+    std::cout << last->key_ << " " << GetDepth(last) << "\n";
+}
+
+// 해당 key의 depth를 return
+template <typename T>
+int SetSkipList<T>::Find(const T key)
+{
+    EpochManager::Guard guard(epoch_manager_);
+    const Node* node = FindNode(key);
+
+    return (node == nullptr) ? -1 : GetDepth(node);
+}
+
+// key를 삽입하고 depth를 return
+template <typename T>
+int SetSkipList<T>::Insert(const T key)
+{
+    EpochManager::Guard guard(epoch_manager_);
+    Node* preds[kMaxHeight];
+    Node* succs[kMaxHeight];
+    const int height = GetRandomHeight();
+    Node* node = nullptr;
+
+    while (true)
+    {
+        if (FindPosition(key, preds, succs))
+        {
+            // 삽입하려고 하는 원소가 이미 Set에 들어있음
+            delete node;
+            return -1;
+        }
+
+        if (node == nullptr)
+        {
+            node = new Node(key, height);
+        }
+
+        for (int level = 0; level < height; level++)
+        {
+            node->next_[level].store(MakeLink(succs[level]), std::memory_order_relaxed);
+        }
+
+        // node가 보이기 전에 가장 높은 높이를 올려두어야 다른 thread가 계산한 depth가 음수가 되지 않음
+        // (height_는 줄어들지 않으므로 CAS가 실패하여 다시 시도하더라도 문제없음)
+        int max_height = height_.load();
+
+        while (max_height < height && !height_.compare_exchange_weak(max_height, height))
+        {
+        }
+
+        // 가장 아래 level에 연결되는 순간 Set에 들어간 것으로 봄
+        std::uintptr_t expected = MakeLink(succs[0]);
+
+        if (preds[0]->next_[0].compare_exchange_strong(expected, MakeLink(node)))
+        {
+            break;
+        }
+    }
+
+    size_.fetch_add(1);
+
+    const int depth = GetDepth(node);
+
+    // 위 level을 차례로 연결 (도중에 삭제 표시가 되면 중단)
+    for (int level = 1; level < height; level++)
+    {
+        bool linked = false;
+
+        while (!linked)
+        {
+            std::uintptr_t next = node->next_[level].load();
+
+            if (IsMarked(next))
+            {
+                break;
+            }
+
+            // node의 다음 pointer를 최신 succ로 맞춘 뒤 pred에 연결
+            if (GetNode(next) != succs[level]
+                && !node->next_[level].compare_exchange_strong(next, MakeLink(succs[level])))
+            {
+                continue;
+            }
+
+            std::uintptr_t expected = MakeLink(succs[level]);
+            linked = preds[level]->next_[level].compare_exchange_strong(expected, MakeLink(node));
+
+            if (!linked)
+            {
+                // pred와 succ가 바뀌었으므로 다시 찾음 (node가 삭제되었으면 중단)
+                FindPosition(key, preds, succs);
+
+                if (succs[0] != node)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (!linked)
+        {
+            break;
+        }
+    }
+
+    Release(node);
+
+    return depth;
+}
+
+// 해당 key의 depth와 rank를 출력
+template <typename T>
+void SetSkipList<T>::Rank(const T key)
+{
+    EpochManager::Guard guard(epoch_manager_);
+    const Node* node = FindNode(key);
+
+    if (node == nullptr)
+    {
+        std::cout << "0\n";
+        return;
+    }
+
+    // 가장 아래 level에서 key보다 작은 삭제되지 않은 node를 셈
+    int rank = 1;
+
+    for (const Node* current = GetNode(head_->next_[0].load());
+        current != nullptr && current->key_ < key;
+        current = GetNode(current->next_[0].load()))
+    {
+        if (!IsMarked(current->next_[0].load()))
+        {
+            rank++;
+        }
+    }
+
+    std::cout << GetDepth(node) << " " << rank;
+}
+
+// 해당 key를 삭제하고 depth를 return
+template <typename T>
+int SetSkipList<T>::Erase(const T key)
+{
+    EpochManager::Guard guard(epoch_manager_);
+    Node* preds[kMaxHeight];
+    Node* succs[kMaxHeight];
+
+    if (!FindPosition(key, preds, succs))
+    {
+        // 삭제하려고 하는 원소를 찾지 못함
+        return -1;
+    }
+
+    Node* node = succs[0];
+    const int depth = GetDepth(node);
+
+    // 위 level부터 삭제 표시
+    for (int level = node->height_ - 1; level >= 1; level--)
+    {
+        std::uintptr_t next = node->next_[level].load();
+
+        while (!IsMarked(next) && !node->next_[level].compare_exchange_weak(next, next | 1))
+        {
+        }
+    }
+
+    // 가장 아래 level에 표시를 남긴 thread가 삭제한 것으로 봄
+    std::uintptr_t next = node->next_[0].load();
+
+    while (true)
+    {
+        if (IsMarked(next))
+        {
+            // 다른 thread가 먼저 삭제함
+            return -1;
+        }
+
+        if (node->next_[0].compare_exchange_weak(next, next | 1))
+        {
+            break;
+        }
+    }
+
+    size_.fetch_sub(1);
+
+    // 표시된 node를 떼어냄
+    FindPosition(key, preds, succs);
+    Release(node);
+
+    return depth;
+}
+
+// key가 Set에 들어있으면 true
+template <typename T>
+bool SetSkipList<T>::Contains(const T key) const
+{
+    EpochManager::Guard guard(epoch_manager_);
+
+    return FindNode(key) != nullptr;
+}
+
+// 1 이상 kMaxHeight 이하의 무작위 높이
+template <typename T>
+int SetSkipList<T>::GetRandomHeight()
+{
+    thread_local std::minstd_rand random(std::random_device{}());
+    int height = 1;
+
+    while (height < kMaxHeight && (random() & 1))
+    {
+        height++;
+    }
+
+    return height;
+}
+
+// level별로 key보다 작은 마지막 node와 그 다음 node를 찾음
+template <typename T>
+bool SetSkipList<T>::FindPosition(const T& key, Node** out_preds, Node** out_succs)
+{
+    // 현재 가장 높은 tower보다 위의 level은 비어있음
+    const int top_level = height_.load() - 1;
+
+    for (int level = kMaxHeight - 1; level > top_level; level--)
+    {
+        out_preds[level] = head_;
+        out_succs[level] = nullptr;
+    }
+
+retry:
+    Node* pred = head_;
+
+    for (int level = top_level; level >= 0; level--)
+    {
+        Node* current = GetNode(pred->next_[level].load());
+
+        while (current != nullptr)
+        {
+            std::uintptr_t next = current->next_[level].load();
+
+            if (IsMarked(next))
+            {
+                // 삭제 표시된 node를 pred에서 떼어냄 (pred가 바뀌었으면 처음부터 다시)
+                std::uintptr_t expected = MakeLink(current);
+
+                if (!pred->next_[level].compare_exchange_strong(expected, next & ~std::uintptr_t(1)))
+                {
+                    goto retry;
+                }
+
+                current = GetNode(next);
+                continue;
+            }
+
+            if (!(current->key_ < key))
+            {
+                break;
+            }
+
+            pred = current;
+            current = GetNode(next);
+        }
+
+        out_preds[level] = pred;
+        out_succs[level] = current;
+    }
+
+    return out_succs[0] != nullptr && out_succs[0]->key_ == key;
+}
+
+// 떼어내지 않고 key를 가진 삭제되지 않은 node를 찾음
+template <typename T>
+typename SetSkipList<T>::Node* SetSkipList<T>::FindNode(const T& key) const
+{
+    Node* pred = head_;
+    Node* current = nullptr;
+
+    for (int level = height_.load() - 1; level >= 0; level--)
+    {
+        current = GetNode(pred->next_[level].load());
+
+        while (current != nullptr)
+        {
+            std::uintptr_t next = current->next_[level].load();
+
+            if (!IsMarked(next) && !(current->key_ < key))
+            {
+                break;
+            }
+
+            if (!IsMarked(next))
+            {
+                pred = current;
+            }
+
+            current = GetNode(next);
+        }
+    }
+
+    if (current == nullptr || !(current->key_ == key) || IsMarked(current->next_[0].load()))
+    {
+        return nullptr;
+    }
+
+    return current;
+}
+
+// 삭제 표시된 node를 모든 level에서 떼어냄
+// 같은 key를 가진 새 node가 앞에 있을 수 있으므로 node의 level에서는 key가 같은 node를 지나가며 찾고,
+// 아래 level은 key보다 작은 마지막 node에서 다시 시작함
+template <typename T>
+void SetSkipList<T>::Unlink(Node* node)
+{
+retry:
+    Node* start = head_;
+
+    for (int level = height_.load() - 1; level >= 0; level--)
+    {
+        Node* pred = start;
+        Node* current = GetNode(pred->next_[level].load());
+
+        while (current != nullptr)
+        {
+            std::uintptr_t next = current->next_[level].load();
+
+            if (IsMarked(next))
+            {
+                std::uintptr_t expected = MakeLink(current);
+
+                if (!pred->next_[level].compare_exchange_strong(expected, next & ~std::uintptr_t(1)))
+                {
+                    goto retry;
+                }
+
+                current = GetNode(next);
+                continue;
+            }
+
+            if (current->key_ < node->key_)
+            {
+                start = current;
+            }
+            else if (level >= node->height_ || node->key_ < current->key_)
+            {
+                break;
+            }
+
+            pred = current;
+            current = GetNode(next);
+        }
+    }
+}
+
+// 삽입한 thread와 삭제한 thread가 모두 작업을 마치면 node를 떼어내고 회수기에 넘김
+// 삽입하는 thread가 위 level에 연결하는 도중 삭제될 수 있으므로
+// 두 작업이 모두 끝난 뒤에 떼어내야 node가 다시 연결되지 않음
+template <typename T>
+void SetSkipList<T>::Release(Node* node)
+{
+    if (node->release_count_.fetch_add(1) == 1)
+    {
+        Unlink(node);
+        epoch_manager_.Retire(node, DeleteNode);
+    }
+}
@@ -0,0 +1,160 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#ifndef SET_Y_FAST_TRIE_H
+#define SET_Y_FAST_TRIE_H
+
+#include "set.h"
+
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// 정수 key 전용 Set (y-fast trie)
+// key를 W bit(T의 bit 수) unsigned 값으로 보고, 정렬된 key를 W ~ 2W개씩 bucket으로 나눔
+// 각 bucket의 대표값을 x-fast trie(bit 길이별 hash table)에 저장하므로
+// key가 들어갈 bucket을 hash table 조회 O(log W)번으로 찾을 수 있음
+//
+// bucket i는 [대표값 i, 대표값 i + 1) 범위의 key를 정렬된 배열로 저장하며,
+// 첫 bucket의 대표값은 항상 가장 작은 값이므로 삽입할 때 대표값을 바꿀 필요가 없음
+//
+// x-fast trie의 각 node는 해당 prefix를 가진 bucket의 key 개수를 함께 저장하므로
+// Rank는 bucket의 대표값의 bit를 따라 내려가며 왼쪽 child의 key 개수를 더해서 O(W)에 구함
+//
+// depth는 bucket의 배열을 가운데 원소 기준으로 나눈 균형 잡힌 tree에서의 depth로 정의
+// Minimum, Maximum은 그 tree에서 key를 root로 하는 subtree를 기준으로 함
+template <typename T>
+class SetYFastTrie : public Set<T>
+{
+    static_assert(std::is_integral<T>::value, "SetYFastTrie requires an integral key type");
+public:
+    SetYFastTrie();
+    ~SetYFastTrie();
+
+    // Basic 기능
+    // key를 root로 하는 subtree에서 최솟값을 갖는 원소의 값과 depth를 출력
+    void Minimum(const T key) override final;
+
+    // key를 root로 하는 subtree에서 최댓값을 갖는 원소의 값과 depth를 출력
+    void Maximum(const T key) override final;
+
+    // Set이 비어있으면 1, 그렇지 않으면 0을 return
+    bool IsEmpty() const override final { return size_ == 0; }
+
+    // Set에 들어있는 원소의 개수 return
+    int GetSize() const override final { return size_; }
+
+    // 해당 key의 depth를 return (없으면 -1)
+    int Find(const T key) override final;
+
+    // key를 삽입하고 depth를 return (이미 있으면 -1)
+    int Insert(const T key) override final;
+
+    // Advanced 기능
+    // 해당 key의 depth와 rank를 출력
+    // rank: Set에서 해당 key보다 작은 key의 개수 + 1
+    // 앞쪽 bucket의 key 개수를 x-fast trie의 node에서 구하므로 O(W)
+    void Rank(const T key) override final;
+
+    // 해당 key를 삭제하고 depth를 return (없으면 -1)
+    int Erase(const T key) override final;
+
+    // key보다 작은 key 중 가장 큰 key를 찾음 (없으면 false)
+    bool Predecessor(const T key, T& out_key) const;
+
+    // key보다 큰 key 중 가장 작은 key를 찾음 (없으면 false)
+    bool Successor(const T key, T& out_key) const;
+private:
+    typedef typename std::make_unsigned<T>::type UnsignedKey;
+
+    // key의 bit 수
+    static constexpr int kBits = static_cast<int>(sizeof(T) * 8);
+
+    // bucket의 최대 크기와 최소 크기 (최소 크기보다 작아지면 이웃 bucket과 합침)
+    static constexpr int kMaxBucketSize = 2 * kBits;
+    static constexpr int kMinBucketSize = kBits / 2;
+
+    struct PrefixNode;
+
+    // 대표값 이상, 다음 bucket의 대표값 미만인 key를 정렬해서 저장
+    // path[l]은 대표값의 길이 l prefix에 해당하는 x-fast trie의 node
+    // (unordered_map의 원소는 삭제되기 전까지 주소가 바뀌지 않고, bucket이 있는 동안 삭제되지 않음)
+    struct Bucket
+    {
+        UnsignedKey representative;
+        std::vector<T> keys;
+        Bucket* prev;
+        Bucket* next;
+        PrefixNode* path[kBits + 1];
+    };
+
+    // x-fast trie의 node: 해당 prefix를 가진 대표값 중 최소, 최대인 bucket과
+    // 그 bucket들에 들어있는 key의 개수
+    struct PrefixNode
+    {
+        Bucket* min_bucket;
+        Bucket* max_bucket;
+        int key_count;
+    };
+
+    // 복사 생성자, 대입 연산자 사용 방지
+    SetYFastTrie(const SetYFastTrie&) = delete;
+    SetYFastTrie& operator=(const SetYFastTrie&) = delete;
+
+    // key를 순서가 유지되는 unsigned 값으로 바꿈 (signed는 부호 bit를 뒤집음)
+    static UnsignedKey ToUnsigned(const T key);
+
+    // 값의 상위 length bit
+    static UnsignedKey GetPrefix(UnsignedKey value, int length);
+
+    // 원소가 count개인 배열의 index번째 원소의 depth
+    static int GetBucketDepth(int count, int index);
+
+    // key가 들어갈 bucket (대표값이 key 이하인 마지막 bucket, Set이 비어있으면 nullptr)
+    Bucket* FindBucket(const T key) const;
+
+    // bucket의 배열에서 key의 index (없으면 -1)
+    static int FindIndex(const Bucket* bucket, const T key);
+
+    // bucket의 배열에서 key를 root로 하는 subtree에 해당하는 범위 [out_begin, out_end)를 찾음
+    // key가 없으면 false
+    static bool FindSubtree(const Bucket* bucket, const T key, int& out_begin, int& out_end);
+
+    // x-fast trie에 bucket의 대표값을 추가, 삭제
+    // 추가할 때 bucket의 key 개수를 path의 node에 더하고, 삭제할 때 뺌
+    void AddRepresentative(Bucket* bucket);
+    void RemoveRepresentative(Bucket* bucket);
+
+    // bucket의 path에 있는 모든 node의 key 개수에 delta를 더함
+    static void AddKeyCount(Bucket* bucket, int delta);
+
+    // bucket보다 앞에 있는 bucket의 key 개수의 합
+    static int CountKeysBefore(const Bucket* bucket);
+
+    // bucket 뒤에 새 bucket을 만들어 bucket의 뒤쪽 절반을 옮김
+    void SplitBucket(Bucket* bucket);
+
+    // 원소가 적어진 bucket을 이웃 bucket과 합침
+    void MergeBucket(Bucket* bucket);
+
+    // Set에 들어있는 원소의 개수
+    int size_;
+
+    // 대표값 순서로 연결된 bucket의 처음
+    Bucket* head_;
+
+    // 길이 l(0 ~ kBits)의 prefix를 key로 하는 hash table
+    std::vector<std::unordered_map<UnsignedKey, PrefixNode>> levels_;
+};
+
+#include "set_y_fast_trie.hpp"
+
+#endif
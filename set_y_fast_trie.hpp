@@ -0,0 +1,539 @@
+/**************************************************
+ * Copyright INHA_OSAP_004_Froyo
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ *
+ * Contributors: Lee Seung-Bin
+ * Latest Updated on 2026-10-19
+**************************************************/
+
+#include "set_y_fast_trie.h"
+
+#include <algorithm>
+#include <iostream>
+
+template <typename T>
+SetYFastTrie<T>::SetYFastTrie() : size_(0), head_(nullptr), levels_(kBits + 1) {}
+
+template <typename T>
+SetYFastTrie<T>::~SetYFastTrie()
+{
+    while (head_ != nullptr)
+    {
+        Bucket* next = head_->next;
+        delete head_;
+        head_ = next;
+    }
+}
+
+// key를 root로 하는 subtree에서 최솟값을 갖는 원소의 값과 depth를 출력
+template <typename T>
+void SetYFastTrie<T>::Minimum(const T key)
+{
+    const Bucket* bucket = FindBucket(key);
+    int begin = 0;
+    int end = 0;
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (bucket == nullptr || !FindSubtree(bucket, key, begin, end))
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    const int count = static_cast<int>(bucket->keys.size());
+    std::cout << bucket->keys[begin] << " " << GetBucketDepth(count, begin) << "\n";
+}
+
+// key를 root로 하는 subtree에서 최댓값을 갖는 원소의 값과 depth를 출력
+template <typename T>
+void SetYFastTrie<T>::Maximum(const T key)
+{
+    const Bucket* bucket = FindBucket(key);
+    int begin = 0;
+    int end = 0;
+
+    // Set에 존재하지 않는 원소에 대한 처리
+    if (bucket == nullptr || !FindSubtree(bucket, key, begin, end))
+    {
+        std::cout << "-1, -1" << std::endl;
+        return;
+    }
+
+    const int count = static_cast<int>(bucket->keys.size());
+    std::cout << bucket->keys[end - 1] << " " << GetBucketDepth(count, end - 1) << "\n";
+}
+
+// 해당 key의 depth를 return
+template <typename T>
+int SetYFastTrie<T>::Find(const T key)
+{
+    const Bucket* bucket = FindBucket(key);
+
+    if (bucket == nullptr)
+    {
+        return -1;
+    }
+
+    int index = FindIndex(bucket, key);
+
+    if (index == -1)
+    {
+        return -1;
+    }
+
+    return GetBucketDepth(static_cast<int>(bucket->keys.size()), index);
+}
+
+// key를 삽입하고 depth를 return
+template <typename T>
+int SetYFastTrie<T>::Insert(const T key)
+{
+    if (head_ == nullptr)
+    {
+        // 첫 bucket의 대표값은 가장 작은 값
+        head_ = new Bucket{ 0, std::vector<T>(), nullptr, nullptr, {} };
+        AddRepresentative(head_);
+    }
+
+    Bucket* bucket = FindBucket(key);
+    auto it = std::lower_bound(bucket->keys.begin(), bucket->keys.end(), key);
+
+    if (it != bucket->keys.end() && *it == key)
+    {
+        // 삽입하려고 하는 원소가 이미 Set에 들어있음
+        return -1;
+    }
+
+    int index = static_cast<int>(it - bucket->keys.begin());
+    bucket->keys.insert(it, key);
+    AddKeyCount(bucket, 1);
+    size_++;
+
+    if (static_cast<int>(bucket->keys.size()) > kMaxBucketSize)
+    {
+        SplitBucket(bucket);
+
+        if (index >= static_cast<int>(bucket->keys.size()))
+        {
+            // key가 새 bucket으로 옮겨짐
+            index -= static_cast<int>(bucket->keys.size());
+            bucket = bucket->next;
+        }
+    }
+
+    return GetBucketDepth(static_cast<int>(bucket->keys.size()), index);
+}
+
+// 해당 key의 depth와 rank를 출력
+template <typename T>
+void SetYFastTrie<T>::Rank(const T key)
+{
+    const Bucket* bucket = FindBucket(key);
+    int index = (bucket == nullptr) ? -1 : FindIndex(bucket, key);
+
+    if (index == -1)
+    {
+        std::cout << "0\n";
+        return;
+    }
+
+    int rank = CountKeysBefore(bucket) + index + 1;
+
+    std::cout << GetBucketDepth(static_cast<int>(bucket->keys.size()), index) << " " << rank;
+}
+
+// 해당 key를 삭제하고 depth를 return
+template <typename T>
+int SetYFastTrie<T>::Erase(const T key)
+{
+    Bucket* bucket = FindBucket(key);
+
+    if (bucket == nullptr)
+    {
+        return -1;
+    }
+
+    int index = FindIndex(bucket, key);
+
+    if (index == -1)
+    {
+        // 삭제하려고 하는 원소를 찾지 못함
+        return -1;
+    }
+
+    int depth = GetBucketDepth(static_cast<int>(bucket->keys.size()), index);
+
+    bucket->keys.erase(bucket->keys.begin() + index);
+    AddKeyCount(bucket, -1);
+    size_--;
+
+    if (static_cast<int>(bucket->keys.size()) < kMinBucketSize)
+    {
+        MergeBucket(bucket);
+    }
+
+    return depth;
+}
+
+// key보다 작은 key 중 가장 큰 key를 찾음
+template <typename T>
+bool SetYFastTrie<T>::Predecessor(const T key, T& out_key) const
+{
+    const Bucket* bucket = FindBucket(key);
+
+    if (bucket == nullptr)
+    {
+        return false;
+    }
+
+    auto it = std::lower_bound(bucket->keys.begin(), bucket->keys.end(), key);
+
+    if (it != bucket->keys.begin())
+    {
+        out_key = *(it - 1);
+        return true;
+    }
+
+    // 앞 bucket의 key는 모두 이 bucket의 대표값보다 작음
+    if (bucket->prev == nullptr)
+    {
+        return false;
+    }
+
+    out_key = bucket->prev->keys.back();
+    return true;
+}
+
+// key보다 큰 key 중 가장 작은 key를 찾음
+template <typename T>
+bool SetYFastTrie<T>::Successor(const T key, T& out_key) const
+{
+    const Bucket* bucket = FindBucket(key);
+
+    if (bucket == nullptr)
+    {
+        return false;
+    }
+
+    auto it = std::upper_bound(bucket->keys.begin(), bucket->keys.end(), key);
+
+    if (it != bucket->keys.end())
+    {
+        out_key = *it;
+        return true;
+    }
+
+    // 뒤 bucket의 key는 모두 뒤 bucket의 대표값 이상이므로 key보다 큼
+    if (bucket->next == nullptr)
+    {
+        return false;
+    }
+
+    out_key = bucket->next->keys.front();
+    return true;
+}
+
+// key를 순서가 유지되는 unsigned 값으로 바꿈
+template <typename T>
+typename SetYFastTrie<T>::UnsignedKey SetYFastTrie<T>::ToUnsigned(const T key)
+{
+    const UnsignedKey sign_bit = std::is_signed<T>::value
+        ? static_cast<UnsignedKey>(UnsignedKey(1) << (kBits - 1)) : UnsignedKey(0);
+
+    return static_cast<UnsignedKey>(static_cast<UnsignedKey>(key) ^ sign_bit);
+}
+
+// 값의 상위 length bit
+template <typename T>
+typename SetYFastTrie<T>::UnsignedKey SetYFastTrie<T>::GetPrefix(UnsignedKey value, int length)
+{
+    // bit 수만큼 shift하는 것은 정의되지 않은 동작이므로 길이 0은 따로 처리
+    return (length == 0) ? UnsignedKey(0) : static_cast<UnsignedKey>(value >> (kBits - length));
+}
+
+// 원소가 count개인 배열의 index번째 원소의 depth
+// 각 subtree의 root는 범위의 왼쪽에서 (원소의 개수 / 2)번째 원소
+template <typename T>
+int SetYFastTrie<T>::GetBucketDepth(int count, int index)
+{
+    int begin = 0;
+    int depth = 0;
+
+    while (true)
+    {
+        int middle = begin + count / 2;
+
+        if (index == middle)
+        {
+            return depth;
+        }
+        else if (index < middle)
+        {
+            count = count / 2;
+        }
+        else
+        {
+            count = count - count / 2 - 1;
+            begin = middle + 1;
+        }
+
+        depth++;
+    }
+}
+
+// key가 들어갈 bucket을 찾음
+// 대표값의 prefix는 길이가 짧을수록 반드시 존재하므로
+// key와 같은 prefix가 존재하는 가장 긴 길이를 이분 탐색으로 찾음
+template <typename T>
+typename SetYFastTrie<T>::Bucket* SetYFastTrie<T>::FindBucket(const T key) const
+{
+    if (head_ == nullptr)
+    {
+        return nullptr;
+    }
+
+    const UnsignedKey value = ToUnsigned(key);
+    int low = 0;
+    int high = kBits;
+
+    while (low < high)
+    {
+        int middle = (low + high + 1) / 2;
+
+        if (levels_[middle].count(GetPrefix(value, middle)) != 0)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle - 1;
+        }
+    }
+
+    const PrefixNode& node = levels_[low].find(GetPrefix(value, low))->second;
+
+    if (low == kBits)
+    {
+        // key가 대표값과 같음
+        return node.min_bucket;
+    }
+
+    if ((value >> (kBits - low - 1)) & 1)
+    {
+        // 오른쪽 child가 없으므로 이 prefix의 대표값은 모두 key보다 작음
+        return node.max_bucket;
+    }
+
+    // 왼쪽 child가 없으므로 이 prefix의 대표값은 모두 key보다 큼
+    // 첫 bucket의 대표값은 가장 작은 값이므로 앞 bucket이 반드시 존재함
+    return node.min_bucket->prev;
+}
+
+// bucket의 배열에서 key의 index
+template <typename T>
+int SetYFastTrie<T>::FindIndex(const Bucket* bucket, const T key)
+{
+    auto it = std::lower_bound(bucket->keys.begin(), bucket->keys.end(), key);
+
+    if (it == bucket->keys.end() || *it != key)
+    {
+        return -1;
+    }
+
+    return static_cast<int>(it - bucket->keys.begin());
+}
+
+// bucket의 배열에서 key를 root로 하는 subtree에 해당하는 범위를 찾음
+template <typename T>
+bool SetYFastTrie<T>::FindSubtree(const Bucket* bucket, const T key, int& out_begin, int& out_end)
+{
+    int begin = 0;
+    int count = static_cast<int>(bucket->keys.size());
+
+    while (count > 0)
+    {
+        int middle = begin + count / 2;
+
+        if (key == bucket->keys[middle])
+        {
+            out_begin = begin;
+            out_end = begin + count;
+            return true;
+        }
+        else if (key < bucket->keys[middle])
+        {
+            count = count / 2;
+        }
+        else
+        {
+            count = count - count / 2 - 1;
+            begin = middle + 1;
+        }
+    }
+
+    return false;
+}
+
+// x-fast trie에 bucket의 대표값을 추가
+template <typename T>
+void SetYFastTrie<T>::AddRepresentative(Bucket* bucket)
+{
+    const UnsignedKey value = bucket->representative;
+
+    const int key_count = static_cast<int>(bucket->keys.size());
+
+    for (int length = 0; length <= kBits; length++)
+    {
+        auto result = levels_[length].emplace(GetPrefix(value, length), PrefixNode{ bucket, bucket, 0 });
+        PrefixNode& node = result.first->second;
+
+        if (!result.second)
+        {
+            if (value < node.min_bucket->representative)
+            {
+                node.min_bucket = bucket;
+            }
+
+            if (node.max_bucket->representative < value)
+            {
+                node.max_bucket = bucket;
+            }
+        }
+
+        node.key_count += key_count;
+        bucket->path[length] = &node;
+    }
+}
+
+// x-fast trie에서 bucket의 대표값을 삭제 (bucket을 목록에서 빼기 전에 호출)
+// 같은 prefix를 가진 대표값은 연속되어 있으므로 최소, 최대 bucket은 이웃 bucket으로 바뀜
+template <typename T>
+void SetYFastTrie<T>::RemoveRepresentative(Bucket* bucket)
+{
+    const UnsignedKey value = bucket->representative;
+
+    AddKeyCount(bucket, -static_cast<int>(bucket->keys.size()));
+
+    for (int length = 0; length <= kBits; length++)
+    {
+        auto it = levels_[length].find(GetPrefix(value, length));
+        PrefixNode& node = it->second;
+
+        if (node.min_bucket == bucket && node.max_bucket == bucket)
+        {
+            levels_[length].erase(it);
+        }
+        else if (node.min_bucket == bucket)
+        {
+            node.min_bucket = bucket->next;
+        }
+        else if (node.max_bucket == bucket)
+        {
+            node.max_bucket = bucket->prev;
+        }
+    }
+}
+
+// bucket의 path에 있는 모든 node의 key 개수에 delta를 더함
+template <typename T>
+void SetYFastTrie<T>::AddKeyCount(Bucket* bucket, int delta)
+{
+    for (int length = 0; length <= kBits; length++)
+    {
+        bucket->path[length]->key_count += delta;
+    }
+}
+
+// bucket보다 앞에 있는 bucket의 key 개수의 합
+// 대표값의 bit가 1인 깊이에서는 왼쪽 child의 prefix를 가진 bucket이 모두 앞에 있으며,
+// 왼쪽 child의 key 개수 = 현재 node의 key 개수 - 오른쪽 child(path의 다음 node)의 key 개수
+template <typename T>
+int SetYFastTrie<T>::CountKeysBefore(const Bucket* bucket)
+{
+    int count = 0;
+
+    for (int length = 0; length < kBits; length++)
+    {
+        if ((bucket->representative >> (kBits - length - 1)) & 1)
+        {
+            count += bucket->path[length]->key_count - bucket->path[length + 1]->key_count;
+        }
+    }
+
+    return count;
+}
+
+// bucket 뒤에 새 bucket을 만들어 bucket의 뒤쪽 절반을 옮김
+template <typename T>
+void SetYFastTrie<T>::SplitBucket(Bucket* bucket)
+{
+    const std::size_t half = bucket->keys.size() / 2;
+    Bucket* new_bucket = new Bucket{ 0,
+        std::vector<T>(bucket->keys.begin() + half, bucket->keys.end()), bucket, bucket->next, {} };
+
+    // 옮기는 key는 bucket의 path에서 빼고, AddRepresentative에서 new_bucket의 path에 더함
+    AddKeyCount(bucket, -static_cast<int>(new_bucket->keys.size()));
+    bucket->keys.resize(half);
+    new_bucket->representative = ToUnsigned(new_bucket->keys.front());
+
+    if (bucket->next != nullptr)
+    {
+        bucket->next->prev = new_bucket;
+    }
+
+    bucket->next = new_bucket;
+    AddRepresentative(new_bucket);
+}
+
+// 원소가 적어진 bucket을 이웃 bucket과 합침
+template <typename T>
+void SetYFastTrie<T>::MergeBucket(Bucket* bucket)
+{
+    Bucket* removed = nullptr;
+
+    if (bucket->next != nullptr)
+    {
+        // 뒤 bucket의 key를 가져오고 뒤 bucket을 제거
+        removed = bucket->next;
+    }
+    else if (bucket->prev != nullptr)
+    {
+        // 앞 bucket으로 key를 옮기고 이 bucket을 제거
+        removed = bucket;
+        bucket = bucket->prev;
+    }
+    else
+    {
+        // bucket이 하나뿐이면 비었을 때만 제거
+        if (bucket->keys.empty())
+        {
+            RemoveRepresentative(bucket);
+            delete bucket;
+            head_ = nullptr;
+        }
+
+        return;
+    }
+
+    // removed의 key 개수는 RemoveRepresentative에서 path의 node에서 빠짐
+    RemoveRepresentative(removed);
+    bucket->keys.insert(bucket->keys.end(), removed->keys.begin(), removed->keys.end());
+    AddKeyCount(bucket, static_cast<int>(removed->keys.size()));
+
+    removed->prev->next = removed->next;
+
+    if (removed->next != nullptr)
+    {
+        removed->next->prev = removed->prev;
+    }
+
+    delete removed;
+
+    if (static_cast<int>(bucket->keys.size()) > kMaxBucketSize)
+    {
+        SplitBucket(bucket);
+    }
+}
@@ -9,13 +9,35 @@
  * Latest Updated on 2023-12-15
 **************************************************/
 
+#include "map_avl.h"
+#include "map_range_sum_avl.h"
 #include "set_avl.h"
+#include "set_avl_wal.h"
+#include "set_btree.h"
+#include "set_factory.h"
+#include "set_hybrid_avl.h"
+#include "set_roaring.h"
+#include "set_skip_list.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
+#include <sys/resource.h>
+
 class SetAVLTestFixture : public testing::Test 
 {
 public:
@@ -439,6 +461,1382 @@ TEST_F(SetAVLTestFixture, SetAVLTest10)
     std::cout << "\n";
 }
 
+// 테스트케이스 11
+TEST_F(SetAVLTestFixture, SetAVLShapeReportTest)
+{
+    SetAVL<int> set;
+
+    SetAVLShapeReport empty_report = set.ShapeReport();
+    ASSERT_EQ(0, empty_report.size);
+    ASSERT_EQ(-1, empty_report.height);
+    ASSERT_TRUE(empty_report.size_consistent);
+
+    for (int key = 1; key <= 1000; key++)
+        set.Insert(key);
+    for (int key = 2; key <= 1000; key += 3)
+        set.Erase(key);
+
+    SetAVLShapeReport report = set.ShapeReport();
+    ASSERT_EQ(set.GetSize(), report.size);
+    ASSERT_TRUE(report.size_consistent);
+    ASSERT_EQ(0, report.unbalanced_count);
+    ASSERT_EQ(report.size, report.left_heavy_count
+        + report.balanced_count + report.right_heavy_count);
+    ASSERT_EQ(report.height, report.max_depth);
+    ASSERT_LE(report.optimal_height, report.height);
+    ASSERT_LE(report.height_ratio, 1.45);
+    ASSERT_GE(report.allocated_bytes_per_node, report.node_bytes);
+}
+
+// 테스트케이스 12
+TEST_F(SetAVLTestFixture, SetAVLSnapshotTest)
+{
+    const std::string path = testing::TempDir() + "set_avl_snapshot_test.bin";
+    SetAVL<int> set;
+
+    for (int key = -500; key <= 500; key += 7)
+        set.Insert(key);
+    set.Insert(2000000000);
+    ASSERT_TRUE(set.SaveSnapshot(path));
+
+    SetAVL<int> loaded_set;
+    loaded_set.Insert(12345);
+    ASSERT_TRUE(loaded_set.LoadSnapshot(path));
+    ASSERT_EQ(set.GetSize(), loaded_set.GetSize());
+    ASSERT_EQ(-1, loaded_set.Find(12345));
+    ASSERT_NE(-1, loaded_set.Find(-500));
+    ASSERT_NE(-1, loaded_set.Find(2000000000));
+    ASSERT_EQ(-1, loaded_set.Find(-499));
+
+    SetAVLShapeReport report = loaded_set.ShapeReport();
+    ASSERT_TRUE(report.size_consistent);
+    ASSERT_EQ(0, report.unbalanced_count);
+    ASSERT_EQ(report.optimal_height, report.height);
+
+    // 불러온 Set에서도 삽입, 삭제가 정상적으로 동작해야 함
+    ASSERT_NE(-1, loaded_set.Insert(3));
+    ASSERT_NE(-1, loaded_set.Erase(-500));
+    ASSERT_EQ(0, loaded_set.ShapeReport().unbalanced_count);
+
+    // 손상된 파일은 거부하고 기존 Set을 유지해야 함
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(30);
+        file.put('\x7f');
+    }
+    ASSERT_FALSE(loaded_set.LoadSnapshot(path));
+    ASSERT_NE(-1, loaded_set.Find(3));
+    ASSERT_FALSE(loaded_set.LoadSnapshot(path + ".missing"));
+
+    // header의 원소 개수가 크고 중간에 끊긴 파일은 node를 할당하기 전에 거부해야 함
+    ASSERT_TRUE(set.SaveSnapshot(path));
+    std::string contents;
+    {
+        std::ifstream file(path, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    const std::uint64_t huge_count = 2000000000;
+    contents.replace(10, sizeof(huge_count), reinterpret_cast<const char*>(&huge_count), sizeof(huge_count));
+    contents.resize(40);
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size());
+    }
+    ASSERT_FALSE(loaded_set.LoadSnapshot(path));
+    ASSERT_EQ(set.GetSize(), loaded_set.GetSize());
+
+    // 원소 개수는 맞지만 key 목록이 중간에 끊긴 파일도 거부해야 함
+    ASSERT_TRUE(set.SaveSnapshot(path));
+    {
+        std::ifstream file(path, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    contents.resize(contents.size() - 20);
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size());
+    }
+    ASSERT_FALSE(loaded_set.LoadSnapshot(path));
+    ASSERT_NE(-1, loaded_set.Find(3));
+}
+
+// 테스트케이스 13
+TEST_F(SetAVLTestFixture, SetAVLWriteAheadLogTest)
+{
+    const std::string directory = testing::TempDir() + "set_avl_wal_test";
+    std::remove((directory + "/snapshot").c_str());
+    std::remove((directory + "/log").c_str());
+
+    {
+        SetAVL<int> set;
+        SetAVLWriteAheadLog<int> wal(set, directory, std::chrono::microseconds(0), 50);
+        ASSERT_TRUE(wal.Open());
+
+        for (int key = 0; key < 120; key++)
+            ASSERT_NE(-1, wal.Insert(key));
+        for (int key = 0; key < 120; key += 2)
+            ASSERT_NE(-1, wal.Erase(key));
+        ASSERT_EQ(-1, wal.Erase(0));
+        ASSERT_EQ(60, set.GetSize());
+    }
+
+    // 기록 도중 crash가 난 것처럼 log 끝에 불완전한 record를 추가
+    {
+        std::ofstream log(directory + "/log", std::ios::binary | std::ios::app);
+        log.write("I\x01\x02", 3);
+    }
+
+    SetAVL<int> recovered_set;
+    SetAVLWriteAheadLog<int> wal(recovered_set, directory, std::chrono::microseconds(100), 50);
+    ASSERT_TRUE(wal.Open());
+    ASSERT_EQ(60, recovered_set.GetSize());
+    ASSERT_EQ(-1, recovered_set.Find(0));
+    ASSERT_NE(-1, recovered_set.Find(119));
+
+    // 잘라낸 log 뒤에 이어서 기록한 record도 복구되어야 함
+    ASSERT_NE(-1, wal.Insert(1000));
+    ASSERT_TRUE(wal.Checkpoint());
+
+    SetAVL<int> checkpointed_set;
+    SetAVLWriteAheadLog<int> checkpointed_wal(
+        checkpointed_set, directory, std::chrono::microseconds(0), 50);
+    ASSERT_TRUE(checkpointed_wal.Open());
+    ASSERT_EQ(61, checkpointed_set.GetSize());
+    ASSERT_NE(-1, checkpointed_set.Find(1000));
+
+    // 파일 크기 제한으로 log 기록이 중간에 실패하게 만듦 (record 하나는 9byte)
+    const long long log_size = [&]()
+    {
+        std::ifstream log(directory + "/log", std::ios::binary | std::ios::ate);
+        return static_cast<long long>(log.tellg());
+    }();
+    ASSERT_NE(-1, checkpointed_wal.Insert(2000));
+    {
+        struct FileSizeLimitGuard
+        {
+            rlimit original;
+            void (*original_handler)(int);
+            FileSizeLimitGuard(rlim_t limit)
+            {
+                getrlimit(RLIMIT_FSIZE, &original);
+                original_handler = std::signal(SIGXFSZ, SIG_IGN);
+                rlimit limited = original;
+                limited.rlim_cur = limit;
+                setrlimit(RLIMIT_FSIZE, &limited);
+            }
+            ~FileSizeLimitGuard()
+            {
+                setrlimit(RLIMIT_FSIZE, &original);
+                std::signal(SIGXFSZ, original_handler);
+            }
+        } guard(static_cast<rlim_t>(log_size + 9 + 4));
+
+        // 4byte만 기록된 뒤 실패하면 -1을 return하고 set과 log 모두 기록 전 상태로 되돌아감
+        ASSERT_EQ(-1, checkpointed_wal.Insert(3000));
+        ASSERT_TRUE(checkpointed_wal.IsFailed());
+        ASSERT_EQ(-1, checkpointed_set.Find(3000));
+
+        // 실패 상태에서는 set을 변경하지 않고 -1을 return
+        ASSERT_EQ(-1, checkpointed_wal.Erase(2000));
+        ASSERT_NE(-1, checkpointed_set.Find(2000));
+        ASSERT_FALSE(checkpointed_wal.Checkpoint());
+    }
+    {
+        std::ifstream log(directory + "/log", std::ios::binary | std::ios::ate);
+        ASSERT_EQ(log_size + 9, static_cast<long long>(log.tellg()));
+    }
+
+    // 다시 열면 기록에 성공한 record까지 복구되고 이어서 기록할 수 있음
+    SetAVL<int> reopened_set;
+    SetAVLWriteAheadLog<int> reopened_wal(reopened_set, directory, std::chrono::microseconds(0), 50);
+    ASSERT_TRUE(reopened_wal.Open());
+    ASSERT_EQ(62, reopened_set.GetSize());
+    ASSERT_NE(-1, reopened_set.Find(2000));
+    ASSERT_EQ(-1, reopened_set.Find(3000));
+    ASSERT_NE(-1, reopened_wal.Insert(3000));
+    ASSERT_EQ(1, reopened_wal.GetDurableRecordCount());
+}
+
+// 테스트케이스 14
+TEST_F(SetAVLTestFixture, SetAVLFindBatchTest)
+{
+    SetAVL<int> set;
+    std::vector<int> keys;
+    std::vector<int> depths;
+
+    set.FindBatch(keys, depths);
+    ASSERT_TRUE(depths.empty());
+
+    keys.push_back(3);
+    set.FindBatch(keys, depths);
+    ASSERT_EQ(std::vector<int>{ -1 }, depths);
+
+    for (int key = 0; key < 300; key += 3)
+        set.Insert(key);
+    for (int key = 500; key >= -20; key--)
+        keys.push_back(key);
+
+    set.FindBatch(keys, depths);
+    ASSERT_EQ(keys.size(), depths.size());
+
+    for (std::size_t i = 0; i < keys.size(); i++)
+        ASSERT_EQ(set.Find(keys[i]), depths[i]);
+}
+
+// 테스트케이스 15
+TEST_F(SetAVLTestFixture, SetAVLQuerySortedTest)
+{
+    SetAVL<int> set;
+    std::vector<int> queries;
+
+    for (int key = 0; key < 200; key += 4)
+        set.Insert(key);
+    for (int key = 0; key < 100; key += 4)
+        set.Erase(key + 40);
+    for (int key = -3; key <= 210; key++)
+    {
+        queries.push_back(key);
+        if (key % 10 == 0)
+            queries.push_back(key);
+    }
+
+    std::vector<SetAVLQueryResult> results;
+    set.QuerySorted(queries, results);
+    ASSERT_EQ(queries.size(), results.size());
+
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        ASSERT_EQ(set.Find(queries[i]), results[i].depth);
+        ASSERT_EQ(set.Contains(queries[i]), results[i].found);
+
+        int expected_rank = 0;
+        if (set.Contains(queries[i]))
+        {
+            expected_rank = 1;
+            for (int key = 0; key < queries[i]; key++)
+                expected_rank += set.Contains(key);
+        }
+        ASSERT_EQ(expected_rank, results[i].rank);
+    }
+
+    std::vector<int> depths;
+    std::vector<int> ranks;
+    std::vector<bool> found;
+    set.FindSorted(queries, depths);
+    set.RankSorted(queries, ranks);
+    set.ContainsSorted(queries, found);
+    ASSERT_EQ(results[5].depth, depths[5]);
+    ASSERT_EQ(results[5].rank, ranks[5]);
+    ASSERT_EQ(results[5].found, found[5]);
+}
+
+// 테스트케이스 16
+TEST_F(SetAVLTestFixture, SetAVLFingerInsertTest)
+{
+    SetAVL<int> set;
+    SetAVL<int> finger_set;
+    std::vector<int> keys;
+
+    // 오름차순, 내림차순, 거의 정렬된 key와 중복된 key를 섞어서 삽입
+    for (int key = 0; key < 100; key++)
+        keys.push_back(key);
+    for (int key = 300; key > 200; key--)
+        keys.push_back(key);
+    for (int key = 100; key < 200; key++)
+        keys.push_back(key % 7 == 0 ? key - 3 : key);
+
+    // 삽입 위치는 hint와 관계없이 같으므로 두 tree의 모양도 같아야 함
+    for (int key : keys)
+        ASSERT_EQ(set.Insert(key), finger_set.InsertNearFinger(key));
+    ASSERT_EQ(set.GetSize(), finger_set.GetSize());
+    for (int key = -1; key <= 301; key++)
+        ASSERT_EQ(set.Find(key), finger_set.Find(key));
+
+    // 마지막으로 삽입한 node가 삭제되면 root node부터 탐색함
+    int last_key = finger_set.GetFinger()->GetKey();
+    ASSERT_NE(-1, finger_set.Erase(last_key));
+    ASSERT_EQ(nullptr, finger_set.GetFinger());
+    ASSERT_NE(-1, set.Erase(last_key));
+    ASSERT_EQ(set.Insert(last_key), finger_set.InsertNearFinger(last_key));
+
+    // 다른 node를 hint로 사용하는 경우
+    SetAVL<int>::Hint hint = finger_set.GetFinger();
+    ASSERT_EQ(-1, finger_set.Insert(hint, 150));
+    ASSERT_EQ(set.Insert(-50), finger_set.Insert(hint, -50));
+    ASSERT_EQ(set.Insert(1000), finger_set.Insert(hint, 1000));
+    for (int key = -50; key <= 1000; key++)
+        ASSERT_EQ(set.Find(key), finger_set.Find(key));
+
+    // 빈 Set에서 삭제
+    SetAVL<int> empty_set;
+    ASSERT_EQ(-1, empty_set.Erase(3));
+}
+
+// 테스트케이스 17
+TEST_F(SetAVLTestFixture, SetAVLMinMaxTest)
+{
+    SetAVL<int> set;
+    int key = 0;
+
+    ASSERT_FALSE(set.GetMin(key));
+    ASSERT_FALSE(set.PopMax(key));
+
+    for (int i = 0; i <= 100; i++)
+        set.Insert((i * 37) % 101);
+    set.Erase(0);
+    set.Erase(100);
+
+    ASSERT_TRUE(set.GetMin(key));
+    ASSERT_EQ(1, key);
+    ASSERT_TRUE(set.GetMax(key));
+    ASSERT_EQ(99, key);
+
+    // 복사한 Set도 같은 최솟값, 최댓값과 모양을 가짐
+    SetAVL<int> copied_set(set);
+    SetAVL<int> assigned_set;
+    assigned_set.Insert(1000);
+    assigned_set = set;
+    for (int i = 0; i <= 100; i++)
+    {
+        ASSERT_EQ(set.Find(i), copied_set.Find(i));
+        ASSERT_EQ(set.Find(i), assigned_set.Find(i));
+    }
+
+    // PopMin, PopMax는 오름차순, 내림차순으로 원소를 꺼냄
+    int previous_min = -1;
+    int previous_max = 101;
+    while (!set.IsEmpty())
+    {
+        ASSERT_TRUE(set.PopMin(key));
+        ASSERT_LT(previous_min, key);
+        previous_min = key;
+        if (set.PopMax(key))
+        {
+            ASSERT_GT(previous_max, key);
+            previous_max = key;
+        }
+    }
+    ASSERT_LT(previous_min, previous_max);
+    ASSERT_FALSE(set.GetMax(key));
+    ASSERT_EQ(99, copied_set.GetSize());
+    ASSERT_TRUE(copied_set.PopMax(key));
+    ASSERT_EQ(99, key);
+}
+
+// 테스트케이스 18
+TEST_F(SetAVLTestFixture, SetAVLNodeHandleTest)
+{
+    SetAVL<int> set;
+    SetAVL<int> other_set;
+
+    for (int key = 0; key < 40; key++)
+        set.Insert(key);
+
+    // 자식이 2개인 node를 삭제해도 다른 node의 위치는 그대로 유지됨
+    set.Insert(100);
+    SetAVL<int>::Hint hint = set.GetFinger();
+    ASSERT_NE(-1, set.Erase(15));
+    ASSERT_NE(-1, set.Erase(31));
+    ASSERT_EQ(100, hint->GetKey());
+    ASSERT_NE(-1, set.Insert(hint, 99));
+
+    // 꺼낸 node를 다른 Set에 다시 연결
+    NodeHandleAVL<int> handle = set.Extract(20);
+    ASSERT_FALSE(handle.IsEmpty());
+    ASSERT_EQ(20, handle.GetKey());
+    ASSERT_EQ(-1, set.Find(20));
+    ASSERT_TRUE(set.Extract(20).IsEmpty());
+    ASSERT_EQ(0, other_set.Insert(handle));
+    ASSERT_TRUE(handle.IsEmpty());
+    ASSERT_EQ(-1, other_set.Insert(handle));
+
+    // 같은 key가 있으면 handle은 node를 그대로 가지고 있음
+    other_set.Insert(5);
+    other_set.Insert(50);
+    handle = set.Extract(5);
+    ASSERT_EQ(-1, other_set.Insert(handle));
+    ASSERT_FALSE(handle.IsEmpty());
+    ASSERT_NE(-1, set.Insert(handle));
+
+    // 같은 key를 가진 5는 other_set에 남음
+    int set_size = set.GetSize();
+    set.Merge(other_set);
+    ASSERT_EQ(set_size + 2, set.GetSize());
+    ASSERT_EQ(1, other_set.GetSize());
+    ASSERT_NE(-1, other_set.Find(5));
+    ASSERT_NE(-1, set.Find(20));
+    ASSERT_NE(-1, set.Find(50));
+
+    int key = 0;
+    ASSERT_TRUE(set.GetMax(key));
+    ASSERT_EQ(100, key);
+    SetAVLShapeReport report = set.ShapeReport();
+    ASSERT_EQ(0, report.unbalanced_count);
+    ASSERT_TRUE(report.size_consistent);
+}
+
+// 테스트케이스 19
+TEST_F(SetAVLTestFixture, SetHybridAVLTest)
+{
+    SetHybridAVL<int, 8> set;
+    SetAVL<int> tree;
+    std::vector<int> keys;
+
+    for (int key = 10; key >= 0; key -= 2)
+        ASSERT_NE(-1, set.Insert(key));
+    ASSERT_EQ(-1, set.Insert(4));
+    ASSERT_TRUE(set.IsInline());
+    ASSERT_EQ(6, set.GetSize());
+
+    // 배열의 depth는 같은 key로 만든 균형 잡힌 SetAVL의 depth와 같음
+    for (int key = 0; key <= 10; key += 2)
+        keys.push_back(key);
+    tree.AssignSorted(keys.begin(), keys.end());
+    for (int key = -1; key <= 11; key++)
+        ASSERT_EQ(tree.Find(key), set.Find(key));
+
+    // 8개를 넘으면 SetAVL로 전환되고 depth는 그대로 유지됨
+    set.Insert(12);
+    set.Insert(14);
+    int depth_before = set.Find(6);
+    ASSERT_TRUE(set.IsInline());
+    set.Insert(16);
+    ASSERT_FALSE(set.IsInline());
+    ASSERT_EQ(depth_before, set.Find(6));
+    ASSERT_EQ(9, set.GetSize());
+
+    // 원소가 4개 이하가 되어야 배열로 돌아감
+    for (int key = 0; key <= 8; key += 2)
+        ASSERT_NE(-1, set.Erase(key));
+    ASSERT_TRUE(set.IsInline());
+    ASSERT_EQ(4, set.GetSize());
+    ASSERT_EQ(-1, set.Erase(0));
+    ASSERT_EQ(0, set.Find(14));
+    ASSERT_EQ(2, set.Find(10));
+
+    testing::internal::CaptureStdout();
+    set.Rank(12);
+    set.Minimum(14);
+    set.Maximum(12);
+    ASSERT_EQ("1 210 2\n12 1\n", testing::internal::GetCapturedStdout());
+}
+
+// 테스트케이스 20
+TEST_F(SetAVLTestFixture, SetRoaringTest)
+{
+    SetRoaring set;
+    int array_count = 0;
+    int bitmap_count = 0;
+    int run_count = 0;
+
+    // 음수와 container 경계를 넘는 key도 순서가 유지됨
+    const int keys[] = { -70000, -1, 0, 1, 65535, 65536, 200000, 2147483647, -2147483647 - 1 };
+    for (int key : keys)
+        ASSERT_EQ(1, set.Insert(key));
+    ASSERT_EQ(-1, set.Insert(0));
+    ASSERT_EQ(9, set.GetSize());
+
+    testing::internal::CaptureStdout();
+    for (int key : keys)
+        set.Rank(key);
+    ASSERT_EQ("1 21 31 41 51 61 71 81 91 1", testing::internal::GetCapturedStdout());
+
+    // 원소가 4096개를 넘으면 bitmap, 다시 줄어들면 array
+    for (int key = 0; key < 5000; key++)
+        set.Insert(key);
+    set.CountContainers(array_count, bitmap_count, run_count);
+    ASSERT_EQ(1, bitmap_count);
+    ASSERT_EQ(1, set.Find(4999));
+    for (int key = 1000; key < 5000; key++)
+        ASSERT_EQ(1, set.Erase(key));
+    set.CountContainers(array_count, bitmap_count, run_count);
+    ASSERT_EQ(0, bitmap_count);
+    ASSERT_EQ(-1, set.Find(4999));
+
+    // 연속된 구간은 Optimize로 run 형식이 되고, 수정해도 결과가 같음
+    size_t bytes_before = set.GetMemoryBytes();
+    set.Optimize();
+    set.CountContainers(array_count, bitmap_count, run_count);
+    ASSERT_EQ(1, run_count);
+    ASSERT_LT(set.GetMemoryBytes(), bytes_before);
+    ASSERT_EQ(1, set.Find(999));
+    ASSERT_EQ(1, set.Erase(500));
+    ASSERT_EQ(-1, set.Find(500));
+
+    testing::internal::CaptureStdout();
+    set.Rank(999);
+    set.Minimum(999);
+    set.Maximum(999);
+    set.Minimum(-70000);
+    ASSERT_EQ("1 10020 1\n65535 1\n-70000 1\n", testing::internal::GetCapturedStdout());
+
+    // 교집합, 합집합
+    SetRoaring other;
+    for (int key = 900; key < 6000; key++)
+        other.Insert(key);
+    SetRoaring intersection = SetRoaring::Intersect(set, other);
+    SetRoaring union_set = SetRoaring::Union(set, other);
+    ASSERT_EQ(100, intersection.GetSize());
+    ASSERT_EQ(1, intersection.Find(950));
+    ASSERT_EQ(-1, intersection.Find(65535));
+    ASSERT_EQ(set.GetSize() + other.GetSize() - 100, union_set.GetSize());
+    ASSERT_EQ(1, union_set.Find(500 + 5000));
+    ASSERT_EQ(-1, union_set.Find(500));
+    ASSERT_EQ(1, union_set.Find(-70000));
+}
+
+// 테스트케이스 21
+TEST_F(SetAVLTestFixture, SetYFastTrieTest)
+{
+    SetYFastTrie<long long> set;
+    std::vector<long long> keys;
+    long long key = 0;
+
+    // 64bit 범위 양 끝의 key와 bucket이 여러 번 나뉠 만큼의 key를 삽입
+    for (long long i = -300; i < 300; i++)
+        keys.push_back(i * 1000000007LL);
+    keys.push_back(9223372036854775807LL);
+    keys.push_back(-9223372036854775807LL - 1);
+    for (long long k : keys)
+        ASSERT_NE(-1, set.Insert(k));
+    ASSERT_EQ(-1, set.Insert(0));
+    ASSERT_EQ(602, set.GetSize());
+
+    ASSERT_TRUE(set.Predecessor(1, key));
+    ASSERT_EQ(0, key);
+    ASSERT_TRUE(set.Successor(0, key));
+    ASSERT_EQ(1000000007LL, key);
+    ASSERT_TRUE(set.Successor(299 * 1000000007LL, key));
+    ASSERT_EQ(9223372036854775807LL, key);
+    ASSERT_FALSE(set.Predecessor(-9223372036854775807LL - 1, key));
+    ASSERT_FALSE(set.Successor(9223372036854775807LL, key));
+
+    // 작은 key부터 삭제해도 남은 key를 모두 찾을 수 있음
+    for (long long i = -300; i < 250; i++)
+        ASSERT_NE(-1, set.Erase(i * 1000000007LL));
+    ASSERT_EQ(-1, set.Erase(0));
+    ASSERT_EQ(52, set.GetSize());
+    ASSERT_EQ(-1, set.Find(249 * 1000000007LL));
+    for (long long i = 250; i < 300; i++)
+        ASSERT_NE(-1, set.Find(i * 1000000007LL));
+    ASSERT_TRUE(set.Predecessor(250 * 1000000007LL, key));
+    ASSERT_EQ(-9223372036854775807LL - 1, key);
+
+    testing::internal::CaptureStdout();
+    set.Rank(250 * 1000000007LL);
+    ASSERT_EQ(std::to_string(set.Find(250 * 1000000007LL)) + " 2",
+        testing::internal::GetCapturedStdout());
+
+    // bucket이 나뉘고 합쳐진 뒤에도 Rank가 앞쪽 bucket의 key 개수를 맞게 셈
+    SetYFastTrie<int> rank_set;
+    std::vector<int> rank_keys;
+    for (int i = 0; i < 3000; i++)
+        rank_keys.push_back((i * 7919) % 100003 - 50000);
+    for (int k : rank_keys)
+        rank_set.Insert(k);
+    for (int i = 0; i < 3000; i += 3)
+        rank_set.Erase(rank_keys[i]);
+    std::vector<int> remaining_keys;
+    for (int i = 0; i < 3000; i++)
+        if (i % 3 != 0)
+            remaining_keys.push_back(rank_keys[i]);
+    std::sort(remaining_keys.begin(), remaining_keys.end());
+    for (int i = 0; i < static_cast<int>(remaining_keys.size()); i += 97)
+    {
+        testing::internal::CaptureStdout();
+        rank_set.Rank(remaining_keys[i]);
+        ASSERT_EQ(std::to_string(rank_set.Find(remaining_keys[i])) + " " + std::to_string(i + 1),
+            testing::internal::GetCapturedStdout());
+    }
+
+    // MakeSet은 원소가 많을 것으로 예상되는 정수 key에만 SetYFastTrie를 만듦
+    ASSERT_NE(nullptr, dynamic_cast<SetAVL<int>*>(MakeSet<int>().get()));
+    std::unique_ptr<Set<int>> int_set = MakeSet<int>(1000000);
+    ASSERT_NE(nullptr, dynamic_cast<SetYFastTrie<int>*>(int_set.get()));
+    ASSERT_NE(-1, int_set->Insert(7));
+    ASSERT_EQ(-1, int_set->Insert(7));
+    ASSERT_EQ(0, int_set->Find(7));
+    ASSERT_EQ(1, int_set->GetSize());
+}
+
+// 테스트케이스 22
+TEST_F(SetAVLTestFixture, SetBTreeTest)
+{
+    SetBTree<int> set;
+    std::vector<int> keys = { 40, 10, 30, 20, 50 };
+
+    // leaf 하나에 들어가는 동안은 depth가 0
+    for (int key : keys)
+        ASSERT_EQ(0, set.Insert(key));
+    ASSERT_EQ(-1, set.Insert(30));
+    ASSERT_EQ(1, set.GetHeight());
+
+    testing::internal::CaptureStdout();
+    set.Rank(30);
+    set.Minimum(30);
+    set.Maximum(30);
+    set.Rank(35);
+    ASSERT_EQ("0 310 0\n50 0\n0\n", testing::internal::GetCapturedStdout());
+
+    // leaf가 여러 번 분할되어도 모든 leaf의 depth는 tree의 높이 - 1
+    for (int key = 1000; key < 5000; key++)
+        set.Insert(key);
+    ASSERT_EQ(4005, set.GetSize());
+    ASSERT_GE(set.GetHeight(), 2);
+    ASSERT_EQ(set.GetHeight() - 1, set.Find(10));
+    ASSERT_EQ(set.GetHeight() - 1, set.Find(4999));
+
+    testing::internal::CaptureStdout();
+    set.Rank(3000);
+    ASSERT_EQ(std::to_string(set.GetHeight() - 1) + " 2006", testing::internal::GetCapturedStdout());
+
+    // 범위 탐색은 연결된 leaf를 따라가며 오름차순으로 전달함
+    std::vector<int> scanned;
+    ASSERT_EQ(8, set.ForEachInRange(25, 1004, [&](int key) { scanned.push_back(key); }));
+    ASSERT_EQ(std::vector<int>({ 30, 40, 50, 1000, 1001, 1002, 1003, 1004 }), scanned);
+
+    // 삭제하면서 node가 합쳐져도 남은 key를 모두 찾을 수 있음
+    for (int key = 1000; key < 4990; key++)
+        ASSERT_NE(-1, set.Erase(key));
+    ASSERT_EQ(-1, set.Erase(1000));
+    ASSERT_EQ(15, set.GetSize());
+    ASSERT_EQ(1, set.GetHeight());
+    for (int key = 4990; key < 5000; key++)
+        ASSERT_EQ(0, set.Find(key));
+    for (int key : keys)
+        ASSERT_NE(-1, set.Erase(key));
+}
+
+// 테스트케이스 23
+TEST_F(SetAVLTestFixture, SetSkipListTest)
+{
+    SetSkipList<int> set;
+
+    // tower의 높이가 무작위이므로 depth 대신 존재 여부와 rank를 확인
+    for (int key = 0; key < 100; key += 2)
+        ASSERT_GE(set.Insert(key), 0);
+    ASSERT_EQ(-1, set.Insert(40));
+    ASSERT_EQ(50, set.GetSize());
+    ASSERT_EQ(-1, set.Find(41));
+    ASSERT_GE(set.Find(42), 0);
+
+    testing::internal::CaptureStdout();
+    set.Rank(40);
+    set.Rank(41);
+    std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(" 210\n", output.substr(output.find(' ')));
+
+    ASSERT_GE(set.Erase(40), 0);
+    ASSERT_EQ(-1, set.Erase(40));
+    ASSERT_FALSE(set.Contains(40));
+    ASSERT_GE(set.Insert(40), 0);
+    ASSERT_TRUE(set.Contains(40));
+
+    // 여러 thread가 서로 다른 key를 동시에 삽입하고 절반을 삭제
+    const int thread_count = 4;
+    const int keys_per_thread = 2000;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([&set, t]()
+        {
+            const int first = 1000 + t * keys_per_thread;
+
+            for (int key = first; key < first + keys_per_thread; key++)
+                set.Insert(key);
+            for (int key = first + 1; key < first + keys_per_thread; key += 2)
+                set.Erase(key);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(50 + thread_count * keys_per_thread / 2, set.GetSize());
+    for (int key = 1000; key < 1000 + thread_count * keys_per_thread; key++)
+        ASSERT_EQ(key % 2 == 0, set.Contains(key));
+
+    // 같은 key를 여러 thread가 동시에 삽입/삭제해도 한 thread만 성공함
+    std::atomic<int> inserted(0);
+    threads.clear();
+
+    for (int t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([&set, &inserted]()
+        {
+            for (int key = 20000; key < 21000; key++)
+                inserted += (set.Insert(key) != -1);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(1000, inserted.load());
+    ASSERT_EQ(50 + thread_count * keys_per_thread / 2 + 1000, set.GetSize());
+
+    // 같은 key에 Insert, Erase, Find를 동시에 섞어 호출해도 성공한 호출은 음수가 아닌 depth를 return하고
+    // 성공한 Insert와 Erase의 개수 차이가 남아있는 key의 개수와 같음
+    // 가장 높은 tower의 높이는 Set이 작을 때 자주 바뀌므로 새 Set으로 여러 번 반복
+    for (int round = 0; round < 200; round++)
+    {
+        SetSkipList<int> mixed_set;
+        std::atomic<int> invalid_count(0);
+        std::atomic<int> balance(0);
+        threads.clear();
+
+        for (int t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back([&mixed_set, &invalid_count, &balance, t, round]()
+            {
+                std::mt19937 random(round * thread_count + t);
+
+                for (int i = 0; i < 200; i++)
+                {
+                    const int key = static_cast<int>(random() % 64);
+                    const int operation = static_cast<int>(random() % 3);
+                    const int result = (operation == 0) ? mixed_set.Insert(key)
+                        : (operation == 1) ? mixed_set.Erase(key) : mixed_set.Find(key);
+
+                    if (result < -1)
+                        invalid_count++;
+                    else if (result >= 0 && operation == 0)
+                        balance++;
+                    else if (result >= 0 && operation == 1)
+                        balance--;
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        ASSERT_EQ(0, invalid_count.load());
+        int contained_count = 0;
+        for (int key = 0; key < 64; key++)
+            contained_count += mixed_set.Contains(key) ? 1 : 0;
+        ASSERT_EQ(balance.load(), contained_count);
+        ASSERT_EQ(contained_count, mixed_set.GetSize());
+    }
+}
+
+// 테스트케이스 24
+TEST_F(SetAVLTestFixture, SetAVLWeakBalancePolicyTest)
+{
+    SetAVL<int> avl_set;
+    SetAVL<int, WeakAVLBalancePolicy> weak_set;
+
+    // 삽입만 하는 경우 AVLBalancePolicy와 같은 모양의 tree
+    for (int key = 0; key < 1000; key++)
+    {
+        int shuffled_key = (key * 379) % 1000;
+        ASSERT_EQ(avl_set.Insert(shuffled_key), weak_set.Insert(shuffled_key));
+    }
+    for (int key = 0; key < 1000; key++)
+        ASSERT_EQ(avl_set.Find(key), weak_set.Find(key));
+    ASSERT_EQ(avl_set.GetRotationCount(), weak_set.GetRotationCount());
+
+    // 삭제 한 번에 rotation은 최대 2번
+    for (int key = 0; key < 1000; key += 3)
+    {
+        long long rotation_count = weak_set.GetRotationCount();
+        ASSERT_NE(-1, weak_set.Erase(key));
+        ASSERT_LE(weak_set.GetRotationCount() - rotation_count, 2);
+    }
+    ASSERT_EQ(-1, weak_set.Erase(0));
+    ASSERT_EQ(666, weak_set.GetSize());
+
+    SetAVLShapeReport report = weak_set.ShapeReport();
+    ASSERT_TRUE(report.size_consistent);
+    ASSERT_LE(report.height, 2 * 10);
+
+    // rank가 아닌 실제 height와 balance factor를 보고해야 함
+    SetAVL<int, WeakAVLBalancePolicy> sparse_set;
+    for (int key = 0; key < 4096; key++)
+        sparse_set.Insert(key);
+    for (int key = 0; key < 4096; key++)
+        if (key % 8 != 0)
+            sparse_set.Erase(key);
+    SetAVLShapeReport sparse_report = sparse_set.ShapeReport();
+    ASSERT_EQ(sparse_report.max_depth, sparse_report.height);
+    ASSERT_EQ(sparse_report.size, sparse_report.left_heavy_count + sparse_report.balanced_count
+        + sparse_report.right_heavy_count + sparse_report.unbalanced_count);
+    ASSERT_DOUBLE_EQ(sparse_report.height / std::log2(sparse_report.size + 1.0), sparse_report.height_ratio);
+
+    testing::internal::CaptureStdout();
+    weak_set.Rank(5);
+    ASSERT_EQ(std::to_string(weak_set.Find(5)) + " 4", testing::internal::GetCapturedStdout());
+
+    // 다시 삽입하고 모두 삭제해도 Set이 올바르게 유지됨
+    for (int key = 0; key < 1000; key += 3)
+        ASSERT_NE(-1, weak_set.Insert(key));
+    for (int key = 999; key >= 0; key--)
+        ASSERT_NE(-1, weak_set.Erase(key));
+    ASSERT_TRUE(weak_set.IsEmpty());
+}
+
+// 테스트케이스 25
+TEST_F(SetAVLTestFixture, SetAVLRelaxedBalanceTest)
+{
+    SetAVL<int> set;
+    set.SetRelaxedBalance(true);
+
+    // rotation 없이 삽입하므로 정렬된 key는 한쪽으로 기울어짐
+    for (int key = 0; key < 1000; key++)
+        ASSERT_EQ(key, set.Insert(key));
+    ASSERT_EQ(0, set.GetRotationCount());
+    ASSERT_EQ(999, set.ShapeReport().height);
+    ASSERT_GT(set.GetPendingCount(), 0);
+
+    // 기울어진 상태에서도 탐색, 삭제, rank는 올바름
+    ASSERT_EQ(500, set.Find(500));
+    ASSERT_EQ(999, set.Erase(999));
+    testing::internal::CaptureStdout();
+    set.Rank(10);
+    ASSERT_EQ("10 11", testing::internal::GetCapturedStdout());
+
+    // budget만큼씩 나누어 rebalancing하고, 모두 끝나면 AVL Tree의 height를 만족함
+    while (set.RebalancePending(8) > 0)
+    {
+    }
+    SetAVLShapeReport report = set.ShapeReport();
+    ASSERT_EQ(0, report.unbalanced_count);
+    ASSERT_LE(report.height, 14);
+    ASSERT_TRUE(report.size_consistent);
+
+    // 연산마다 budget만큼 rebalancing하면 기록이 쌓이지 않음
+    set.SetRelaxedBalance(true, 2);
+    for (int key = 1000; key < 3000; key++)
+        ASSERT_NE(-1, set.Insert(key));
+    for (int key = 0; key < 3000; key += 2)
+        ASSERT_NE(-1, set.Erase(key));
+    ASSERT_LE(set.GetPendingCount(), 2);
+
+    // 끄면 남은 기록을 모두 rebalancing함
+    set.SetRelaxedBalance(false);
+    ASSERT_EQ(0, set.GetPendingCount());
+    ASSERT_EQ(0, set.ShapeReport().unbalanced_count);
+    ASSERT_EQ(1499, set.GetSize());
+}
+
+// 테스트케이스 26
+TEST_F(SetAVLTestFixture, SetAVLFreezeTest)
+{
+    SetAVL<int> set;
+    for (int key = 1; key <= 10; key++)
+        set.Insert(key * 10);
+
+    FrozenSetAVL<int> frozen_set = set.Freeze();
+
+    // 원래 Set을 바꿔도 FrozenSetAVL은 그대로
+    set.Erase(50);
+    set.Insert(55);
+    ASSERT_EQ(10, frozen_set.GetSize());
+    ASSERT_TRUE(frozen_set.Contains(50));
+    ASSERT_FALSE(frozen_set.Contains(55));
+
+    // 원소 10개의 complete binary tree: 위치 1의 root node는 오름차순 7번째 원소
+    ASSERT_EQ(0, frozen_set.Find(70));
+    ASSERT_EQ(3, frozen_set.Find(10));
+    ASSERT_EQ(-1, frozen_set.Find(15));
+    for (int key = 1; key <= 10; key++)
+        ASSERT_EQ(key, frozen_set.GetRank(key * 10));
+    ASSERT_EQ(0, frozen_set.GetRank(5));
+
+    testing::internal::CaptureStdout();
+    frozen_set.Minimum(70);
+    frozen_set.Maximum(40);
+    frozen_set.Rank(60);
+    frozen_set.Minimum(15);
+    ASSERT_EQ("10 3\n60 2\n2 6-1, -1\n", testing::internal::GetCapturedStdout());
+
+    // 빈 Set
+    FrozenSetAVL<int> empty_set = SetAVL<int>().Freeze();
+    ASSERT_TRUE(empty_set.IsEmpty());
+    ASSERT_EQ(-1, empty_set.Find(0));
+    ASSERT_EQ(0, empty_set.GetRank(0));
+}
+
+// 테스트케이스 27
+TEST_F(SetAVLTestFixture, SetAVLCompactTest)
+{
+    SetAVL<int> set;
+    for (int key = 1; key <= 200; key++)
+        set.Insert((key * 37) % 211);
+    for (int key = 1; key <= 200; key += 3)
+        set.Erase((key * 37) % 211);
+
+    std::vector<int> depths;
+    for (int key = 0; key < 211; key++)
+        depths.push_back(set.Find(key));
+
+    // 옮기는 순서와 관계없이 tree의 모양은 그대로
+    set.Compact();
+    for (int key = 0; key < 211; key++)
+        ASSERT_EQ(depths[key], set.Find(key));
+
+    set.Compact(kSetAVLCompactVanEmdeBoas);
+    for (int key = 0; key < 211; key++)
+        ASSERT_EQ(depths[key], set.Find(key));
+
+    // 옮긴 node로 Insert, Erase, Extract, Merge를 계속할 수 있음
+    set.Insert(300);
+    set.Erase(300);
+    NodeHandleAVL<int> handle = set.Extract(74);
+    ASSERT_FALSE(handle.IsEmpty());
+    SetAVL<int> other;
+    other.Insert(handle);
+    other.Compact();
+    set.Merge(other);
+    ASSERT_TRUE(other.IsEmpty());
+    ASSERT_TRUE(set.Contains(74));
+
+    // 나누어 진행하는 도중에 삭제, 삽입을 해도 모든 node를 옮긴 뒤 끝남
+    int call_count = 0;
+    while (!set.CompactIncrementally(std::chrono::microseconds(0)))
+    {
+        set.Erase(210 - call_count);
+        set.Insert(1000 + call_count);
+        call_count++;
+    }
+    ASSERT_GT(call_count, 0);
+    ASSERT_EQ(set.GetSize(), set.ShapeReport().size);
+    ASSERT_EQ(0, set.ShapeReport().unbalanced_count);
+
+    int previous = -1;
+    for (int key = 0; key < 1000 + call_count; key++)
+    {
+        if (set.Contains(key))
+        {
+            ASSERT_LT(previous, key);
+            previous = key;
+        }
+    }
+
+    // 나누어 옮긴 node를 모두 삭제한 뒤 Compact를 호출해도 빈 영역이 쌓이지 않음
+    SetAVL<int> large_set;
+    for (int key = 0; key < 1000; key++)
+        large_set.Insert(key);
+    for (int round = 0; round < 5; round++)
+    {
+        // 시간이 없으면 시간을 처음 확인하기 전까지의 가장 작은 key들만 옮김
+        ASSERT_FALSE(large_set.CompactIncrementally(std::chrono::microseconds(0)));
+        for (int key = 0; key < 63; key++)
+            ASSERT_NE(-1, large_set.Erase(key));
+        large_set.Compact();
+        ASSERT_EQ(1, large_set.GetRegionCount());
+        for (int key = 0; key < 63; key++)
+            large_set.Insert(key);
+    }
+    ASSERT_EQ(1000, large_set.GetSize());
+    for (int key = 0; key < 1000; key++)
+        ASSERT_TRUE(large_set.Contains(key));
+}
+
+// 테스트케이스 28
+TEST_F(SetAVLTestFixture, SetAVLMembershipFilterTest)
+{
+    SetAVL<int> set;
+    for (int key = 1; key <= 100; key++)
+        set.Insert(key * 2);
+    set.SetMembershipFilter(true);
+
+    // filter는 Set에 있는 key를 없다고 판단하지 않으며 Find의 결과는 바뀌지 않음
+    const BlockedBloomFilter<int>* filter = set.GetMembershipFilter();
+    ASSERT_NE(nullptr, filter);
+    for (int key = 1; key <= 100; key++)
+    {
+        ASSERT_TRUE(filter->MayContain(key * 2));
+        ASSERT_EQ(-1, set.Find(key * 2 + 1));
+        ASSERT_FALSE(set.Contains(key * 2 + 1));
+    }
+
+    // 원소가 filter를 만들 때의 2배를 넘으면 더 큰 filter로 다시 만듦
+    for (int key = 101; key <= 1000; key++)
+        set.Insert(key * 2);
+    filter = set.GetMembershipFilter();
+    ASSERT_GE(filter->GetCapacity(), filter->GetKeyCount());
+    for (int key = 1; key <= 1000; key++)
+        ASSERT_TRUE(set.Contains(key * 2));
+
+    // 삭제된 key가 절반을 넘으면 다시 만들므로 stale key가 절반 이하로 유지됨
+    for (int key = 1; key <= 900; key++)
+    {
+        set.Erase(key * 2);
+        ASSERT_LE(2 * filter->GetStaleCount(), filter->GetKeyCount());
+    }
+    ASSERT_EQ(-1, set.Find(2));
+    ASSERT_EQ(100, set.GetSize());
+
+    // false positive 비율은 약 1%
+    int false_positive_count = 0;
+    for (int key = 0; key < 10000; key++)
+        false_positive_count += filter->MayContain(key * 2 + 1);
+    ASSERT_LT(false_positive_count, 500);
+
+    // 복사한 Set은 filter 설정을 가져가지 않음
+    SetAVL<int> copied_set(set);
+    ASSERT_EQ(nullptr, copied_set.GetMembershipFilter());
+
+    set.Clear();
+    ASSERT_EQ(-1, set.Find(1802));
+    ASSERT_EQ(0, set.Insert(7));
+    ASSERT_EQ(0, set.Find(7));
+
+    set.SetMembershipFilter(false);
+    ASSERT_EQ(nullptr, set.GetMembershipFilter());
+    ASSERT_TRUE(set.Contains(7));
+}
+
+// 테스트케이스 29
+TEST_F(SetAVLTestFixture, SetAVLHashIndexTest)
+{
+    SetAVL<int> set;
+    for (int key = 1; key <= 500; key++)
+        set.Insert((key * 7) % 503);
+
+    std::vector<int> depths;
+    for (int key = 0; key < 503; key++)
+        depths.push_back(set.Find(key));
+
+    // hash index로 찾아도 depth는 tree를 내려가며 찾은 것과 같음
+    set.SetHashIndex(true);
+    ASSERT_EQ(500, set.GetHashIndex()->GetSize());
+    for (int key = 0; key < 503; key++)
+    {
+        ASSERT_EQ(depths[key], set.Find(key));
+        ASSERT_EQ(depths[key] >= 0, set.Contains(key));
+    }
+
+    // rotation, 삭제, Compact 이후에도 index가 가리키는 node가 유효함
+    for (int key = 0; key < 503; key += 2)
+        set.Erase(key);
+    for (int key = 1000; key < 1300; key++)
+        set.Insert(key);
+    set.Compact();
+    ASSERT_EQ(set.GetSize(), set.GetHashIndex()->GetSize());
+    for (int key = 0; key < 1300; key++)
+    {
+        const bool expected = (key < 503) ? (key % 2 == 1 && depths[key] >= 0) : (key >= 1000);
+        ASSERT_EQ(expected, set.Contains(key));
+    }
+
+    // Extract로 떼어낸 node는 index에서도 빠짐
+    NodeHandleAVL<int> handle = set.Extract(1000);
+    ASSERT_FALSE(set.Contains(1000));
+    ASSERT_EQ(-1, set.Find(1000));
+    set.Insert(handle);
+    ASSERT_TRUE(set.Contains(1000));
+
+    set.Clear();
+    ASSERT_EQ(0, set.GetHashIndex()->GetSize());
+    ASSERT_EQ(0, set.Insert(3));
+    ASSERT_EQ(0, set.Find(3));
+
+    set.SetHashIndex(false);
+    ASSERT_EQ(nullptr, set.GetHashIndex());
+    ASSERT_TRUE(set.Contains(3));
+}
+
+// 테스트케이스 30
+TEST_F(SetAVLTestFixture, SetAVLHotKeyCacheTest)
+{
+    SetAVL<int> set;
+    SetAVL<int> plain_set;
+    for (int key = 1; key <= 300; key++)
+    {
+        set.Insert((key * 11) % 307);
+        plain_set.Insert((key * 11) % 307);
+    }
+    set.SetHotKeyCache(true, 64);
+
+    // 처음 찾으면 miss, 같은 key를 다시 찾으면 hit
+    ASSERT_EQ(plain_set.Find(11), set.Find(11));
+    ASSERT_EQ(plain_set.Find(11), set.Find(11));
+    ASSERT_EQ(-1, set.Find(1000));
+    HotKeyCacheStats stats = set.GetHotKeyCacheStats();
+    ASSERT_EQ(1, stats.hit_count);
+    ASSERT_EQ(0, stats.stale_hit_count);
+    ASSERT_EQ(2, stats.miss_count);
+
+    // cache를 거친 Rank는 tree를 순회하는 Rank와 같은 결과를 출력함
+    for (int key = 0; key < 310; key += 7)
+    {
+        testing::internal::CaptureStdout();
+        plain_set.Rank(key);
+        const std::string expected = testing::internal::GetCapturedStdout();
+        testing::internal::CaptureStdout();
+        set.Rank(key);
+        ASSERT_EQ(expected, testing::internal::GetCapturedStdout());
+    }
+
+    // 삽입, 삭제로 tree 모양이 바뀌면 저장된 depth는 stale이 되어 다시 계산됨
+    for (int key = 400; key < 500; key++)
+    {
+        set.Insert(key);
+        plain_set.Insert(key);
+    }
+    set.Erase(22);
+    plain_set.Erase(22);
+    set.ResetHotKeyCacheStats();
+    ASSERT_EQ(plain_set.Find(11), set.Find(11));
+    ASSERT_EQ(1, set.GetHotKeyCacheStats().stale_hit_count);
+    ASSERT_EQ(-1, set.Find(22));
+    for (int key = 0; key < 500; key++)
+    {
+        ASSERT_EQ(plain_set.Find(key), set.Find(key));
+        ASSERT_EQ(plain_set.Find(key), set.Find(key));
+    }
+
+    // Compact로 node가 옮겨지거나 Clear로 모두 삭제되어도 옛 node를 가리키지 않음
+    set.Compact();
+    for (int key = 0; key < 500; key++)
+        ASSERT_EQ(plain_set.Find(key), set.Find(key));
+    set.Clear();
+    ASSERT_EQ(-1, set.Find(11));
+    ASSERT_EQ(0, set.Insert(11));
+    ASSERT_EQ(0, set.Find(11));
+
+    set.SetHotKeyCache(false);
+    ASSERT_EQ(0, set.Find(11));
+    ASSERT_EQ(0, set.GetHotKeyCacheStats().hit_count);
+}
+
+// 테스트케이스 31
+struct IsMultipleOfThree
+{
+    bool operator()(int key) const { return key % 3 == 0; }
+};
+
+TEST_F(SetAVLTestFixture, SetAVLAugmentationTest)
+{
+    // Augmentation이 없으면 node는 NodeAVL 그대로임
+    static_assert(std::is_same<SetAVLAugmentationTraits<int, SetAVLNoAugmentation>::Node, NodeAVL<int>>::value,
+        "SetAVL without augmentation must use NodeAVL");
+
+    SetAVL<int, AVLBalancePolicy, SetAVLSumAugmentation<int>> set;
+    for (int key = 1; key <= 200; key++)
+        set.Insert((key * 37) % 211);
+
+    // rotation이 일어난 뒤에도 모든 범위의 합이 맞음
+    auto expected_sum = [&set](int lo, int hi)
+    {
+        long long sum = 0;
+        for (int key = std::max(lo, 0); key <= hi && key < 211; key++)
+            sum += set.Contains(key) ? key : 0;
+        return sum;
+    };
+    for (int lo = -5; lo < 215; lo += 7)
+        for (int hi = lo; hi < 220; hi += 13)
+            ASSERT_EQ(expected_sum(lo, hi), set.Aggregate(lo, hi));
+    ASSERT_EQ(0, set.Aggregate(300, 400));
+    ASSERT_EQ(0, set.Aggregate(10, 5));
+
+    // 삭제, Compact, 복사 이후에도 aggregate가 유지됨
+    for (int key = 0; key < 211; key += 3)
+        set.Erase(key);
+    set.Compact(kSetAVLCompactVanEmdeBoas);
+    SetAVL<int, AVLBalancePolicy, SetAVLSumAugmentation<int>> copied_set(set);
+    for (int lo = 0; lo < 211; lo += 10)
+    {
+        ASSERT_EQ(expected_sum(lo, lo + 50), set.Aggregate(lo, lo + 50));
+        ASSERT_EQ(expected_sum(lo, lo + 50), copied_set.Aggregate(lo, lo + 50));
+    }
+
+    // Extract한 node는 같은 Augmentation을 가진 Set에 다시 넣을 수 있음
+    NodeHandleAVL<int, SetAVLSumAugmentation<int>> handle = set.Extract(37);
+    ASSERT_EQ(copied_set.Aggregate(0, 210) - 37, set.Aggregate(0, 210));
+    set.Insert(handle);
+    ASSERT_EQ(copied_set.Aggregate(0, 210), set.Aggregate(0, 210));
+
+    // predicate를 만족하는 key의 개수
+    SetAVL<int, WeakAVLBalancePolicy, SetAVLCountIfAugmentation<int, IsMultipleOfThree>> count_set;
+    for (int key = 0; key < 100; key++)
+        count_set.Insert(key);
+    for (int key = 0; key < 100; key += 2)
+        count_set.Erase(key);
+    ASSERT_EQ(17, count_set.Aggregate(0, 99));
+    ASSERT_EQ(2, count_set.Aggregate(10, 25));
+}
+
+// 테스트케이스 32
+struct MapAVLTestValue
+{
+    static int construct_count;
+    static int copy_count;
+
+    MapAVLTestValue(int first, int second) : sum(first + second) { construct_count++; }
+    MapAVLTestValue(const MapAVLTestValue& other) : sum(other.sum) { copy_count++; }
+    MapAVLTestValue& operator=(const MapAVLTestValue& other)
+    {
+        sum = other.sum;
+        copy_count++;
+        return *this;
+    }
+
+    int sum;
+};
+
+int MapAVLTestValue::construct_count = 0;
+int MapAVLTestValue::copy_count = 0;
+
+TEST_F(SetAVLTestFixture, MapAVLTest)
+{
+    MapAVL<int, std::string> map;
+    ASSERT_TRUE(map.IsEmpty());
+    ASSERT_EQ(nullptr, map.Find(1));
+
+    // InsertOrAssign은 삽입했으면 true, 대입했으면 false
+    ASSERT_TRUE(map.InsertOrAssign(5, "five"));
+    ASSERT_TRUE(map.InsertOrAssign(3, "three"));
+    ASSERT_FALSE(map.InsertOrAssign(5, "FIVE"));
+    ASSERT_EQ(2, map.GetSize());
+    ASSERT_EQ("FIVE", *map.Find(5));
+
+    // TryEmplace는 이미 있는 key의 value를 바꾸지 않음
+    ASSERT_EQ("three", map.TryEmplace(3, "THREE"));
+    ASSERT_EQ("seven", map.TryEmplace(7, "seven"));
+    *map.Find(7) += "!";
+    ASSERT_EQ("seven!", *map.Find(7));
+
+    for (int key : { 3, 5, 7 })
+        ASSERT_NE(-1, map.Erase(key));
+    ASSERT_TRUE(map.IsEmpty());
+
+    // key의 depth, rotation은 SetAVL과 같음
+    SetAVL<int> set;
+    for (int key = 0; key < 100; key++)
+    {
+        map.InsertOrAssign(key * 2, std::to_string(key));
+        set.Insert(key * 2);
+        ASSERT_EQ(set.Find(key * 2), map.GetKeys().Find(key * 2));
+    }
+    ASSERT_EQ(set.GetRotationCount(), map.GetKeys().GetRotationCount());
+
+    // 삭제, Compact, Extract, 복사 이후에도 value가 key를 따라감
+    for (int key = 0; key < 200; key += 6)
+        ASSERT_EQ(set.Erase(key), map.Erase(key));
+    map.GetKeys().Compact();
+    NodeHandleAVL<int, MapAVLValue<std::string>> handle = map.GetKeys().Extract(8);
+    ASSERT_FALSE(map.Contains(8));
+    map.GetKeys().Insert(handle);
+    MapAVL<int, std::string> copied_map(map);
+    for (int key = 0; key < 200; key++)
+    {
+        const std::string* value = copied_map.Find(key);
+        if (key % 6 == 0 || key % 2 == 1)
+        {
+            ASSERT_EQ(nullptr, value);
+            continue;
+        }
+        ASSERT_EQ(std::to_string(key / 2), *value);
+        ASSERT_EQ(*value, *map.Find(key));
+    }
+
+    // TryEmplace는 value를 node 안에서 바로 생성하고 임시 객체를 복사하지 않음
+    MapAVL<std::string, MapAVLTestValue> object_map;
+    ASSERT_EQ(3, object_map.TryEmplace("a", 1, 2).sum);
+    ASSERT_EQ(3, object_map.TryEmplace("a", 10, 20).sum);
+    object_map.TryEmplace("b", 3, 4);
+    ASSERT_EQ(2, MapAVLTestValue::construct_count);
+    ASSERT_EQ(0, MapAVLTestValue::copy_count);
+    ASSERT_FALSE(object_map.InsertOrAssign("b", MapAVLTestValue(5, 6)));
+    ASSERT_EQ(11, object_map.Find("b")->sum);
+
+    // 기본 생성자가 없는 value는 key set에 key만 삽입할 수 없음 (hint를 주어도 같음)
+    ASSERT_EQ(-1, object_map.GetKeys().Insert("c"));
+    ASSERT_EQ(-1, object_map.GetKeys().Insert(object_map.GetKeys().GetFinger(), "c"));
+    ASSERT_FALSE(object_map.Contains("c"));
+    ASSERT_EQ(2, object_map.GetSize());
+
+    object_map.Clear();
+    ASSERT_TRUE(object_map.IsEmpty());
+    ASSERT_EQ(nullptr, object_map.Find("a"));
+}
+
+// 테스트케이스 33
+TEST_F(SetAVLTestFixture, MapRangeSumAVLTest)
+{
+    MapRangeSumAVL<int, long long> map;
+    std::vector<long long> values(300, 0);
+    std::vector<bool> present(300, false);
+    for (int key = 0; key < 300; key += 3)
+    {
+        ASSERT_TRUE(map.InsertOrAssign(key, key));
+        values[key] = key;
+        present[key] = true;
+    }
+
+    auto expected_sum = [&](int lo, int hi)
+    {
+        long long sum = 0;
+        for (int key = std::max(lo, 0); key <= hi && key < 300; key++)
+            sum += present[key] ? values[key] : 0;
+        return sum;
+    };
+    auto add_range = [&](int lo, int hi, long long delta)
+    {
+        map.AddRange(lo, hi, delta);
+        for (int key = std::max(lo, 0); key <= hi && key < 300; key++)
+            values[key] += delta;
+    };
+
+    // 겹치는 범위에 여러 번 더해도 범위의 합과 각 value가 맞음
+    add_range(10, 200, 5);
+    add_range(-10, 50, -2);
+    add_range(150, 400, 7);
+    for (int lo = -5; lo < 300; lo += 11)
+        ASSERT_EQ(expected_sum(lo, lo + 40), map.SumRange(lo, lo + 40));
+    long long value = 0;
+    ASSERT_TRUE(map.Find(30, value));
+    ASSERT_EQ(33, value);
+    ASSERT_FALSE(map.Find(31, value));
+    ASSERT_EQ(0, map.SumRange(301, 500));
+
+    // tag가 남아있는 상태에서 삽입, 삭제로 rotation이 일어나도 tag가 올바른 node에 적용됨
+    for (int key = 1; key < 300; key += 3)
+    {
+        map.InsertOrAssign(key, 1);
+        values[key] = 1;
+        present[key] = true;
+        add_range(key - 20, key, 1);
+    }
+    for (int key = 0; key < 300; key += 6)
+    {
+        ASSERT_NE(-1, map.Erase(key));
+        present[key] = false;
+    }
+    ASSERT_FALSE(map.InsertOrAssign(1, 100));
+    values[1] = 100;
+    ASSERT_EQ(expected_sum(0, 299), map.SumRange(0, 299));
+    for (int key = 0; key < 300; key++)
+    {
+        ASSERT_EQ(present[key], map.Find(key, value));
+        if (present[key])
+        {
+            ASSERT_EQ(values[key], value);
+        }
+    }
+
+    // Compact, 복사한 Map도 같은 값을 가짐
+    map.GetKeys().Compact();
+    MapRangeSumAVL<int, long long> copied_map(map);
+    add_range(0, 299, 1);
+    for (int lo = 0; lo < 300; lo += 25)
+    {
+        // 복사한 뒤에 더한 1은 복사한 Map에 적용되지 않음
+        const int count = static_cast<int>(
+            std::count(present.begin() + lo, present.begin() + std::min(lo + 61, 300), true));
+        ASSERT_EQ(expected_sum(lo, lo + 60), map.SumRange(lo, lo + 60));
+        ASSERT_EQ(expected_sum(lo, lo + 60) - count, copied_map.SumRange(lo, lo + 60));
+    }
+
+    map.Clear();
+    ASSERT_TRUE(map.IsEmpty());
+    ASSERT_EQ(0, map.SumRange(0, 299));
+}
+
 int main()
 {
     testing::InitGoogleTest();